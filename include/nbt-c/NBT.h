@@ -71,6 +71,8 @@ enum NBT_CompressionType {
     NBT_COMPRESSION_NONE = 0,
     NBT_COMPRESSION_GZIP = 1,
     NBT_COMPRESSION_ZLIB = 2,
+    NBT_COMPRESSION_ZSTD = 3,
+    NBT_COMPRESSION_LZ4  = 4,
 };
 
 enum SNBT_NumberFormat {
@@ -203,6 +205,8 @@ NBT_API NBT_FileFormat nbt_detect_content_format(const uint8_t* data, size_t siz
 NBT_API NBT_CompressionType nbt_detect_file_compression_type(const char* path, bool fmmap);
 NBT_API NBT_CompressionType nbt_detect_content_compression_type(const uint8_t* data, size_t size);
 
+NBT_API bool nbt_is_compression_supported(NBT_CompressionType type);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
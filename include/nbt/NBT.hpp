@@ -6,10 +6,15 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #pragma once
+#include <nbt/io/MappedFile.hpp>
 #include <nbt/io/NBTIO.hpp>
+#include <nbt/io/NbtReader.hpp>
+#include <nbt/io/NbtWriter.hpp>
+#include <nbt/io/SaveScheduler.hpp>
 #include <nbt/types/Literals.hpp>
 #include <nbt/types/NbtContent.hpp>
 #include <nbt/types/NbtFile.hpp>
+#include <nbt/types/NbtView.hpp>
 
 namespace nbt {
 
@@ -6,8 +6,12 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #pragma once
+#include <algorithm>
 #include <binarystream/ReadOnlyBinaryStream.hpp>
+#include <bit>
+#include <cstring>
 #include <nbt-c/Macros.h>
+#include <span>
 
 namespace nbt::io {
 
@@ -18,6 +22,7 @@ protected:
     std::string      mOwnedBuffer;
     std::string_view mBufferView;
     const bool       mIsLittleEndian;
+    bool             mIsValidated;
 
 public:
     [[nodiscard]] NBT_API explicit BytesDataInput(bool isLittleEndian = true);
@@ -29,6 +34,12 @@ public:
 
     [[nodiscard]] NBT_API bool hasDataLeft() const noexcept;
 
+    [[nodiscard]] NBT_API bool isOverflowed() const noexcept;
+
+    [[nodiscard]] NBT_API bool isLittleEndian() const noexcept;
+
+    [[nodiscard]] NBT_API bool isValidated() const noexcept;
+
     NBT_API void ignoreBytes(size_t length) noexcept;
 
     NBT_API size_t getPosition() const noexcept;
@@ -37,6 +48,39 @@ public:
 
     NBT_API void getBytes(void* target, size_t num) noexcept;
 
+    NBT_API void getSwappedBytes(void* target, size_t count, size_t elementSize) noexcept;
+
+    template <typename T>
+    void getArray(std::span<T> target) noexcept {
+        getSwappedBytes(target.data(), target.size(), sizeof(T));
+    }
+
+    template <std::endian Order, typename T, bool Checked = true>
+    [[nodiscard]] T getNumber() noexcept {
+        T result{};
+        if constexpr (Checked) {
+            getBytes(&result, sizeof(T));
+        } else {
+            std::memcpy(&result, mBufferView.data() + mReadPointer, sizeof(T));
+            mReadPointer += sizeof(T);
+        }
+        if constexpr (Order != std::endian::little && sizeof(T) > 1) { result = bstream::detail::swapEndian(result); }
+        return result;
+    }
+
+    template <std::endian Order, bool Checked = true>
+    std::string_view getStringView() noexcept {
+        auto             length = static_cast<size_t>(getNumber<Order, int16_t, Checked>());
+        std::string_view result;
+        if constexpr (Checked) {
+            result = mBufferView.substr(std::min(mReadPointer, mBufferView.size()), length);
+        } else {
+            result = std::string_view(mBufferView.data() + mReadPointer, length);
+        }
+        mReadPointer += length;
+        return result;
+    }
+
     NBT_API void getString(std::string& result);
 
     [[nodiscard]] NBT_API std::string getString();
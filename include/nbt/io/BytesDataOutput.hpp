@@ -6,13 +6,25 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #pragma once
+#include <functional>
 #include <nbt/io/BytesDataInput.hpp>
+#include <span>
 
 namespace nbt::io {
 
 class BytesDataOutput : public BytesDataInput {
+public:
+    using Sink = std::function<void(std::string_view data)>;
+
 protected:
-    std::string& mBuffer;
+    std::string&                          mBuffer;
+    std::span<const std::span<std::byte>> mSegments{};
+    size_t                                mSegmentIndex{0};
+    size_t                                mSegmentOffset{0};
+    size_t                                mSegmentWritten{0};
+    Sink                                  mSink{};
+    size_t                                mFlushThreshold{0};
+    size_t                                mFlushedSize{0};
 
 public:
     [[nodiscard]] NBT_API explicit BytesDataOutput(bool isLittleEndian = true);
@@ -21,11 +33,39 @@ public:
         bool         copyBuffer     = false,
         bool         isLittleEndian = true
     );
+    [[nodiscard]] NBT_API explicit BytesDataOutput(
+        std::span<const std::span<std::byte>> segments,
+        bool                                  isLittleEndian = true
+    );
+    [[nodiscard]] NBT_API BytesDataOutput(Sink sink, size_t flushThreshold, bool isLittleEndian = true);
 
     [[nodiscard]] NBT_API std::string getAndReleaseData();
 
+    [[nodiscard]] NBT_API size_t getWrittenSize() const noexcept;
+
+    NBT_API void flush();
+
     NBT_API void writeBytes(const void* origin, size_t num);
 
+    NBT_API void writeSwappedBytes(const void* origin, size_t count, size_t elementSize);
+
+    template <typename T>
+    void writeArray(std::span<const T> values) {
+        writeSwappedBytes(values.data(), values.size(), sizeof(T));
+    }
+
+    template <std::endian Order, typename T>
+    void writeNumber(T value) {
+        if constexpr (Order != std::endian::little && sizeof(T) > 1) { value = bstream::detail::swapEndian(value); }
+        writeBytes(&value, sizeof(T));
+    }
+
+    template <std::endian Order>
+    void writeString(std::string_view value) {
+        writeNumber<Order>(static_cast<int16_t>(value.size()));
+        writeBytes(value.data(), value.size());
+    }
+
     NBT_API void writeString(std::string_view value);
 
     NBT_API void writeLongString(std::string_view value);
@@ -41,6 +81,8 @@ public:
     NBT_API void writeInt(int value);
 
     NBT_API void writeInt64(int64_t value);
+
+    NBT_API void writeIntAt(size_t position, int value);
 };
 
 } // namespace nbt
\ No newline at end of file
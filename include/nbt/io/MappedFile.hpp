@@ -0,0 +1,43 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <filesystem>
+#include <nbt-c/Macros.h>
+#include <optional>
+#include <string_view>
+
+namespace nbt::io {
+
+class MappedFile {
+protected:
+    const char* mData{nullptr};
+    size_t      mSize{0};
+
+public:
+    [[nodiscard]] NBT_API MappedFile(MappedFile&& other) noexcept;
+    NBT_API MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    NBT_API ~MappedFile();
+
+    [[nodiscard]] NBT_API std::string_view getContent() const noexcept;
+
+    [[nodiscard]] NBT_API size_t getSize() const noexcept;
+
+public:
+    [[nodiscard]] NBT_API static std::optional<MappedFile> open(std::filesystem::path const& path);
+
+protected:
+    MappedFile(const char* data, size_t size) noexcept;
+
+    void unmap() noexcept;
+};
+
+} // namespace nbt::io
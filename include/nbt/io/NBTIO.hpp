@@ -11,12 +11,18 @@
 #include <nbt/types/NbtCompressionLevel.hpp>
 #include <nbt/types/NbtCompressionType.hpp>
 #include <nbt/types/NbtFileFormat.hpp>
+#include <nbt/types/NbtFormatConfidence.hpp>
+#include <nbt/types/NbtSaveMode.hpp>
+#include <span>
 
 namespace nbt::io {
 
 [[nodiscard]] NBT_API std::optional<NbtFileFormat>
                       detectContentFormat(std::string_view content, bool strictMatchSize = true);
 
+[[nodiscard]] NBT_API std::optional<std::pair<NbtFileFormat, NbtFormatConfidence>>
+detectContentFormatWithConfidence(std::string_view content, bool strictMatchSize = true);
+
 [[nodiscard]] NBT_API std::optional<NbtFileFormat>
 detectFileFormat(std::filesystem::path const& path, bool fileMemoryMap = false, bool strictMatchSize = true);
 
@@ -25,17 +31,44 @@ detectFileCompressionType(std::filesystem::path const& path, bool fileMemoryMap
 
 [[nodiscard]] NBT_API NbtCompressionType detectContentCompressionType(std::string_view content);
 
+[[nodiscard]] NBT_API bool isCompressionSupported(NbtCompressionType type) noexcept;
+
 [[nodiscard]] NBT_API std::optional<CompoundTag> parseFromContent(
     std::string_view             content,
     std::optional<NbtFileFormat> format          = std::nullopt,
-    bool                         strictMatchSize = true
+    bool                         strictMatchSize = true,
+    bool                         retainSource    = false
+);
+
+[[nodiscard]] NBT_API std::vector<std::optional<CompoundTag>> parseBatch(
+    std::span<const std::string_view> contents,
+    std::optional<NbtFileFormat>      format          = std::nullopt,
+    size_t                            threadCount     = 0,
+    bool                              strictMatchSize = true
+);
+
+[[nodiscard]] NBT_API std::vector<std::optional<CompoundTagVariant>> extract(
+    std::string_view                  content,
+    std::optional<NbtFileFormat>      format,
+    std::span<const std::string_view> paths,
+    bool                              strictMatchSize = true
 );
 
+[[nodiscard]] inline std::vector<std::optional<CompoundTagVariant>> extract(
+    std::string_view                        content,
+    std::optional<NbtFileFormat>            format,
+    std::initializer_list<std::string_view> paths,
+    bool                                    strictMatchSize = true
+) {
+    return extract(content, format, std::span(paths.begin(), paths.size()), strictMatchSize);
+}
+
 [[nodiscard]] NBT_API std::optional<CompoundTag> parseFromFile(
     std::filesystem::path const& path,
     std::optional<NbtFileFormat> format          = std::nullopt,
     bool                         fileMemoryMap   = false,
-    bool                         strictMatchSize = true
+    bool                         strictMatchSize = true,
+    bool                         retainSource    = false
 );
 
 [[nodiscard]] NBT_API std::string saveAsBinary(
@@ -46,13 +79,32 @@ detectFileCompressionType(std::filesystem::path const& path, bool fileMemoryMap
     std::optional<int>  headerVersion    = std::nullopt
 );
 
+[[nodiscard]] NBT_API std::optional<size_t> saveAsBinary(
+    CompoundTag const&   nbt,
+    std::span<std::byte> output,
+    NbtFileFormat        format           = NbtFileFormat::LittleEndian,
+    NbtCompressionType   compressionType  = NbtCompressionType::Gzip,
+    NbtCompressionLevel  compressionLevel = NbtCompressionLevel::Default,
+    std::optional<int>   headerVersion    = std::nullopt
+);
+
+[[nodiscard]] NBT_API std::vector<std::string> saveBatch(
+    std::span<const CompoundTag> nbts,
+    NbtFileFormat                format           = NbtFileFormat::LittleEndian,
+    NbtCompressionType           compressionType  = NbtCompressionType::Gzip,
+    NbtCompressionLevel          compressionLevel = NbtCompressionLevel::Default,
+    std::optional<int>           headerVersion    = std::nullopt,
+    size_t                       threadCount      = 0
+);
+
 NBT_API bool saveToFile(
     CompoundTag const&           nbt,
     std::filesystem::path const& path,
     NbtFileFormat                format           = NbtFileFormat::LittleEndian,
     NbtCompressionType           compressionType  = NbtCompressionType::Gzip,
     NbtCompressionLevel          compressionLevel = NbtCompressionLevel::Default,
-    std::optional<int>           headerVersion    = std::nullopt
+    std::optional<int>           headerVersion    = std::nullopt,
+    NbtSaveMode                  saveMode         = NbtSaveMode::Direct
 );
 
 [[nodiscard]] NBT_API std::optional<CompoundTag> parseSnbtFromFile(std::filesystem::path const& path);
@@ -62,7 +114,8 @@ NBT_API bool saveSnbtToFile(
     std::filesystem::path const& path,
     SnbtFormat                   format          = SnbtFormat::Default,
     uint8_t                      indent          = 4,
-    SnbtNumberFormat             nbtNumberFormat = SnbtNumberFormat::Default
+    SnbtNumberFormat             nbtNumberFormat = SnbtNumberFormat::Default,
+    NbtSaveMode                  saveMode        = NbtSaveMode::Direct
 );
 
 [[nodiscard]] NBT_API std::optional<CompoundTag>
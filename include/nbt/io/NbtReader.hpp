@@ -0,0 +1,119 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <functional>
+#include <istream>
+#include <nbt/types/NbtFileFormat.hpp>
+#include <nbt/types/Tag.hpp>
+#include <optional>
+#include <span>
+
+namespace nbt::io {
+
+class NbtHandler {
+public:
+    virtual ~NbtHandler() = default;
+
+    virtual bool onKey(std::string_view) { return true; }
+
+    virtual bool onCompoundBegin() { return true; }
+    virtual bool onCompoundEnd() { return true; }
+
+    virtual bool onListBegin(Tag::Type, size_t) { return true; }
+    virtual bool onListEnd() { return true; }
+
+    virtual bool onByte(uint8_t) { return true; }
+    virtual bool onShort(int16_t) { return true; }
+    virtual bool onInt(int) { return true; }
+    virtual bool onLong(int64_t) { return true; }
+    virtual bool onFloat(float) { return true; }
+    virtual bool onDouble(double) { return true; }
+    virtual bool onString(std::string_view) { return true; }
+
+    virtual bool onByteArrayBegin(size_t) { return true; }
+    virtual bool onByteArrayChunk(std::span<const uint8_t>) { return true; }
+    virtual bool onByteArrayEnd() { return true; }
+
+    virtual bool onIntArrayBegin(size_t) { return true; }
+    virtual bool onIntArrayChunk(std::span<const int>) { return true; }
+    virtual bool onIntArrayEnd() { return true; }
+
+    virtual bool onLongArrayBegin(size_t) { return true; }
+    virtual bool onLongArrayChunk(std::span<const int64_t>) { return true; }
+    virtual bool onLongArrayEnd() { return true; }
+};
+
+class NbtReader {
+public:
+    using Source = std::function<size_t(char* buffer, size_t size)>;
+
+    static constexpr size_t DefaultBufferSize = 64 * 1024;
+    static constexpr size_t ArrayChunkSize    = 1024;
+
+protected:
+    Source             mSource;
+    NbtFileFormat      mFormat;
+    std::string        mBuffer;
+    size_t             mBegin{0};
+    size_t             mEnd{0};
+    size_t             mPosition{0};
+    bool               mEndOfSource{false};
+    bool               mFailed{false};
+    std::optional<int> mHeaderVersion{};
+
+public:
+    [[nodiscard]] NBT_API NbtReader(Source source, NbtFileFormat format, size_t bufferSize = DefaultBufferSize);
+    [[nodiscard]] NBT_API NbtReader(std::istream& stream, NbtFileFormat format, size_t bufferSize = DefaultBufferSize);
+    [[nodiscard]] NBT_API NbtReader(std::string_view content, NbtFileFormat format);
+
+    NBT_API bool parse(NbtHandler& handler);
+
+    [[nodiscard]] NBT_API bool hasFailed() const noexcept;
+
+    [[nodiscard]] NBT_API size_t getPosition() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<int> getHeaderVersion() const noexcept;
+
+protected:
+    [[nodiscard]] bool fill(size_t size);
+
+    [[nodiscard]] bool read(void* target, size_t size);
+
+    [[nodiscard]] bool needsSwap() const noexcept;
+
+    [[nodiscard]] std::optional<uint64_t> readUnsignedVarInt();
+
+    [[nodiscard]] std::optional<uint8_t> readByte();
+
+    [[nodiscard]] std::optional<int16_t> readShort();
+
+    [[nodiscard]] std::optional<int> readInt();
+
+    [[nodiscard]] std::optional<int64_t> readLong();
+
+    [[nodiscard]] std::optional<float> readFloat();
+
+    [[nodiscard]] std::optional<double> readDouble();
+
+    [[nodiscard]] std::optional<size_t> readLength();
+
+    [[nodiscard]] std::optional<std::string_view> readString();
+
+    [[nodiscard]] bool readPayload(NbtHandler& handler, Tag::Type type);
+
+    [[nodiscard]] bool readCompound(NbtHandler& handler);
+
+    [[nodiscard]] bool readList(NbtHandler& handler);
+
+    [[nodiscard]] bool readByteArray(NbtHandler& handler);
+
+    template <typename T, typename Reader, typename Begin, typename Chunk, typename End>
+    [[nodiscard]] bool readArray(Reader&& reader, Begin&& onBegin, Chunk&& onChunk, End&& onEnd);
+};
+
+} // namespace nbt::io
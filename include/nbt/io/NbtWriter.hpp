@@ -0,0 +1,133 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <binarystream/BinaryStream.hpp>
+#include <functional>
+#include <nbt/io/BytesDataOutput.hpp>
+#include <nbt/types/NbtFileFormat.hpp>
+#include <nbt/types/Tag.hpp>
+#include <ostream>
+#include <span>
+
+namespace nbt::io {
+
+class NbtWriter {
+public:
+    using Sink = std::function<void(std::string_view data)>;
+
+    static constexpr size_t DefaultFlushThreshold = 64 * 1024;
+
+protected:
+    struct Scope {
+        Tag::Type mType;
+        Tag::Type mElementType;
+        size_t    mRemaining;
+    };
+
+    NbtFileFormat         mFormat;
+    Sink                  mSink;
+    size_t                mFlushThreshold;
+    std::string           mBuffer;
+    BytesDataOutput       mStream;
+    bstream::BinaryStream mNetworkStream;
+    std::vector<Scope>    mScopes;
+    size_t                mFlushedSize{0};
+    bool                  mHasHeader{false};
+    bool                  mHasRoot{false};
+    bool                  mFinished{false};
+
+public:
+    [[nodiscard]] NBT_API explicit NbtWriter(NbtFileFormat format = NbtFileFormat::LittleEndian, int headerVersion = 0);
+    [[nodiscard]] NBT_API NbtWriter(
+        Sink          sink,
+        NbtFileFormat format         = NbtFileFormat::LittleEndian,
+        int           headerVersion  = 0,
+        size_t        flushThreshold = DefaultFlushThreshold
+    );
+    [[nodiscard]] NBT_API NbtWriter(
+        std::ostream& stream,
+        NbtFileFormat format         = NbtFileFormat::LittleEndian,
+        int           headerVersion  = 0,
+        size_t        flushThreshold = DefaultFlushThreshold
+    );
+    [[nodiscard]] NBT_API NbtWriter(
+        BytesDataOutput& stream,
+        NbtFileFormat    format        = NbtFileFormat::LittleEndian,
+        int              headerVersion = 0
+    );
+
+    NBT_API ~NbtWriter();
+
+    NbtWriter(NbtWriter const&)            = delete;
+    NbtWriter& operator=(NbtWriter const&) = delete;
+
+    NBT_API void beginCompound();
+    NBT_API void beginCompound(std::string_view key);
+    NBT_API void endCompound();
+
+    NBT_API void beginList(Tag::Type type, size_t count);
+    NBT_API void beginList(std::string_view key, Tag::Type type, size_t count);
+    NBT_API void endList();
+
+    NBT_API void writeByte(uint8_t value);
+    NBT_API void writeByte(std::string_view key, uint8_t value);
+
+    NBT_API void writeShort(int16_t value);
+    NBT_API void writeShort(std::string_view key, int16_t value);
+
+    NBT_API void writeInt(int value);
+    NBT_API void writeInt(std::string_view key, int value);
+
+    NBT_API void writeLong(int64_t value);
+    NBT_API void writeLong(std::string_view key, int64_t value);
+
+    NBT_API void writeFloat(float value);
+    NBT_API void writeFloat(std::string_view key, float value);
+
+    NBT_API void writeDouble(double value);
+    NBT_API void writeDouble(std::string_view key, double value);
+
+    NBT_API void writeString(std::string_view value);
+    NBT_API void writeString(std::string_view key, std::string_view value);
+
+    NBT_API void writeByteArray(std::span<const uint8_t> value);
+    NBT_API void writeByteArray(std::string_view key, std::span<const uint8_t> value);
+
+    NBT_API void writeIntArray(std::span<const int> value);
+    NBT_API void writeIntArray(std::string_view key, std::span<const int> value);
+
+    NBT_API void writeLongArray(std::span<const int64_t> value);
+    NBT_API void writeLongArray(std::string_view key, std::span<const int64_t> value);
+
+    NBT_API void writeTag(Tag const& tag);
+    NBT_API void writeTag(std::string_view key, Tag const& tag);
+
+    NBT_API void flush();
+
+    NBT_API void finish();
+
+    [[nodiscard]] NBT_API size_t getWrittenSize() const noexcept;
+
+    [[nodiscard]] NBT_API std::string getAndReleaseData();
+
+protected:
+    void beginValue(Tag::Type type);
+    void beginValue(Tag::Type type, std::string_view key);
+    void endValue();
+
+    template <typename Fn>
+    void encode(Fn&& fn) {
+        if (mFormat == NbtFileFormat::BedrockNetwork) {
+            fn(mNetworkStream);
+        } else {
+            fn(mStream);
+        }
+    }
+};
+
+} // namespace nbt::io
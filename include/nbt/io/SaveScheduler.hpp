@@ -0,0 +1,92 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <nbt/types/CompoundTag.hpp>
+#include <nbt/types/NbtCompressionLevel.hpp>
+#include <nbt/types/NbtCompressionType.hpp>
+#include <nbt/types/NbtFileFormat.hpp>
+#include <nbt/types/NbtSaveMode.hpp>
+#include <nbt/types/SnbtFormat.hpp>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace nbt::io {
+
+class SaveScheduler {
+public:
+    using Task = std::function<bool()>;
+
+    struct Job {
+        std::string              mKey;
+        Task                     mTask;
+        std::promise<bool>       mPromise;
+        std::shared_future<bool> mFuture;
+    };
+
+    using JobList = std::list<Job>;
+
+protected:
+    mutable std::mutex                                 mMutex;
+    std::condition_variable                            mWakeup;
+    std::condition_variable                            mIdle;
+    JobList                                            mQueue;
+    std::unordered_map<std::string, JobList::iterator> mPending;
+    std::unordered_set<std::string>                    mBusy;
+    std::vector<std::thread>                           mWorkers;
+    bool                                               mStopping{false};
+
+public:
+    [[nodiscard]] NBT_API explicit SaveScheduler(size_t threadCount = 0);
+
+    NBT_API ~SaveScheduler();
+
+    SaveScheduler(SaveScheduler const&)            = delete;
+    SaveScheduler& operator=(SaveScheduler const&) = delete;
+
+    NBT_API std::shared_future<bool> enqueue(
+        CompoundTag                  nbt,
+        std::filesystem::path const& path,
+        NbtFileFormat                format           = NbtFileFormat::LittleEndian,
+        NbtCompressionType           compressionType  = NbtCompressionType::Gzip,
+        NbtCompressionLevel          compressionLevel = NbtCompressionLevel::Default,
+        std::optional<int>           headerVersion    = std::nullopt,
+        NbtSaveMode                  saveMode         = NbtSaveMode::Atomic
+    );
+
+    NBT_API std::shared_future<bool> enqueueSnbt(
+        CompoundTag                  nbt,
+        std::filesystem::path const& path,
+        SnbtFormat                   format          = SnbtFormat::Default,
+        uint8_t                      indent          = 4,
+        SnbtNumberFormat             nbtNumberFormat = SnbtNumberFormat::Default,
+        NbtSaveMode                  saveMode        = NbtSaveMode::Atomic
+    );
+
+    NBT_API std::shared_future<bool> schedule(std::filesystem::path const& path, Task task);
+
+    NBT_API void flush();
+
+    [[nodiscard]] NBT_API size_t getPendingCount() const;
+
+    [[nodiscard]] NBT_API size_t getThreadCount() const noexcept;
+
+protected:
+    void stop() noexcept;
+
+    void run();
+};
+
+} // namespace nbt::io
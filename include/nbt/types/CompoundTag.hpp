@@ -6,9 +6,12 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #pragma once
-#include <map>
+#include <functional>
+#include <nbt/types/NbtFileFormat.hpp>
 #include <nbt/types/Tag.hpp>
+#include <nbt/types/TagMap.hpp>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace nbt {
@@ -29,11 +32,20 @@ class LongArrayTag;
 
 class CompoundTag : public Tag {
 public:
-    using TagMap = std::map<std::string, CompoundTagVariant, std::less<>>;
+    using TagMap = nbt::TagMap;
+
+    struct Source {
+        std::shared_ptr<const void> mOwner;
+        std::string_view            mPayload;
+        NbtFileFormat               mFormat;
+    };
 
 public:
     TagMap mTagMap{};
 
+protected:
+    std::unique_ptr<const Source> mSource{};
+
 public:
     using iterator               = TagMap::iterator;
     using const_iterator         = TagMap::const_iterator;
@@ -44,6 +56,12 @@ public:
     [[nodiscard]] NBT_API CompoundTag() = default;
     [[nodiscard]] NBT_API CompoundTag(std::initializer_list<TagMap::value_type> tagPairs) : mTagMap(tagPairs) {}
 
+    [[nodiscard]] NBT_API CompoundTag(CompoundTag const& other);
+    [[nodiscard]] NBT_API CompoundTag(CompoundTag&& other) noexcept;
+
+    NBT_API CompoundTag& operator=(CompoundTag const& other);
+    NBT_API CompoundTag& operator=(CompoundTag&& other) noexcept;
+
     [[nodiscard]] NBT_API Type getType() const override;
 
     [[nodiscard]] NBT_API bool equals(Tag const& other) const override;
@@ -68,6 +86,14 @@ public:
     [[nodiscard]] NBT_API TagMap&       storage() noexcept;
     [[nodiscard]] NBT_API TagMap const& storage() const noexcept;
 
+    [[nodiscard]] NBT_API bool isDirty() const noexcept;
+
+    NBT_API void markDirty() noexcept;
+
+    [[nodiscard]] NBT_API std::string_view getSourcePayload() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<NbtFileFormat> getSourceFormat() const noexcept;
+
 public:
     [[nodiscard]] NBT_API CompoundTagVariant&       operator[](std::string_view index);
     [[nodiscard]] NBT_API CompoundTagVariant const& operator[](std::string_view index) const;
@@ -133,6 +159,29 @@ public:
     NBT_API void deserialize(bstream::ReadOnlyBinaryStream& stream);
     NBT_API void deserialize(io::BytesDataInput& stream);
 
+    [[nodiscard]] NBT_API size_t computeBinarySize(NbtFileFormat format = NbtFileFormat::LittleEndian) const noexcept;
+
+    NBT_API size_t writeTo(
+        std::string&       output,
+        NbtFileFormat      format        = NbtFileFormat::LittleEndian,
+        std::optional<int> headerVersion = std::nullopt
+    ) const noexcept;
+    [[nodiscard]] NBT_API std::optional<size_t> writeTo(
+        std::span<std::byte> output,
+        NbtFileFormat        format        = NbtFileFormat::LittleEndian,
+        std::optional<int>   headerVersion = std::nullopt
+    ) const noexcept;
+    [[nodiscard]] NBT_API std::optional<size_t> writeTo(
+        std::span<const std::span<std::byte>> output,
+        NbtFileFormat                         format        = NbtFileFormat::LittleEndian,
+        std::optional<int>                    headerVersion = std::nullopt
+    ) const noexcept;
+    NBT_API size_t writeTo(
+        std::function<void(std::string_view data)> const& sink,
+        NbtFileFormat                                     format        = NbtFileFormat::LittleEndian,
+        std::optional<int>                                headerVersion = std::nullopt
+    ) const;
+
     [[nodiscard]] NBT_API std::string toNetworkNbt() const noexcept;
     [[nodiscard]] NBT_API std::string toBinaryNbt(bool isLittleEndian = true) const noexcept;
     [[nodiscard]] NBT_API             std::string
@@ -143,6 +192,10 @@ public:
     [[nodiscard]] NBT_API static CompoundTag fromBinaryNbt(std::string_view binaryData, bool isLittleEndian = true);
     [[nodiscard]] NBT_API static CompoundTag
     fromBinaryNbtWithHeader(std::string_view binaryData, bool isLittleEndian = true);
+    [[nodiscard]] NBT_API static CompoundTag
+    fromSharedBinary(std::shared_ptr<const std::string> binaryData, NbtFileFormat format);
+    [[nodiscard]] NBT_API static CompoundTag
+    fromSharedContent(std::shared_ptr<const void> owner, std::string_view content, NbtFileFormat format);
 
     [[nodiscard]] NBT_API static bool validateNetworkNbt(std::string_view binaryData);
     [[nodiscard]] NBT_API static bool validateBinaryNbt(std::string_view binaryData, bool isLittleEndian = true);
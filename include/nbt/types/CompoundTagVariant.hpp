@@ -157,6 +157,7 @@ public:
     }
 
     NBT_API Tag& emplace(Tag&& tag);
+    NBT_API Tag& emplace(Tag::Type type);
 
     template <typename T>
         requires std::derived_from<std::remove_cvref_t<T>, Tag>
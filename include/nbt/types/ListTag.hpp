@@ -7,6 +7,7 @@
 
 #pragma once
 #include <nbt/types/Tag.hpp>
+#include <span>
 #include <vector>
 
 namespace nbt {
@@ -70,6 +71,20 @@ public:
 
     [[nodiscard]] NBT_API Type getElementType() const;
 
+    [[nodiscard]] NBT_API bool isPacked() const noexcept;
+
+    template <typename T>
+    [[nodiscard]] std::span<T> values() {
+        auto data = packedStorage(packedType<T>());
+        return {reinterpret_cast<T*>(data.data()), data.size() / sizeof(T)};
+    }
+
+    template <typename T>
+    [[nodiscard]] std::span<const T> values() const {
+        auto data = packedStorage(packedType<T>());
+        return {reinterpret_cast<const T*>(data.data()), data.size() / sizeof(T)};
+    }
+
     NBT_API void push_back(std::unique_ptr<Tag>&& tag);
     NBT_API void push_back(Tag const& tag);
     NBT_API void push_back(CompoundTagVariant val);
@@ -88,36 +103,58 @@ public:
 
     NBT_API void clear() noexcept;
 
-    [[nodiscard]] NBT_API TagList&       storage() noexcept;
-    [[nodiscard]] NBT_API TagList const& storage() const noexcept;
+    [[nodiscard]] NBT_API TagList&       storage();
+    [[nodiscard]] NBT_API TagList const& storage() const;
 
-    [[nodiscard]] NBT_API CompoundTagVariant&       operator[](size_t index) noexcept;
-    [[nodiscard]] NBT_API CompoundTagVariant const& operator[](size_t index) const noexcept;
+    [[nodiscard]] NBT_API CompoundTagVariant&       operator[](size_t index);
+    [[nodiscard]] NBT_API CompoundTagVariant const& operator[](size_t index) const;
 
     [[nodiscard]] NBT_API CompoundTagVariant&       at(size_t index);
     [[nodiscard]] NBT_API CompoundTagVariant const& at(size_t index) const;
 
-    [[nodiscard]] NBT_API iterator begin() noexcept;
-    [[nodiscard]] NBT_API iterator end() noexcept;
+    [[nodiscard]] NBT_API iterator begin();
+    [[nodiscard]] NBT_API iterator end();
 
-    [[nodiscard]] NBT_API const_iterator begin() const noexcept;
-    [[nodiscard]] NBT_API const_iterator end() const noexcept;
+    [[nodiscard]] NBT_API const_iterator begin() const;
+    [[nodiscard]] NBT_API const_iterator end() const;
 
-    [[nodiscard]] NBT_API const_iterator cbegin() const noexcept;
-    [[nodiscard]] NBT_API const_iterator cend() const noexcept;
+    [[nodiscard]] NBT_API const_iterator cbegin() const;
+    [[nodiscard]] NBT_API const_iterator cend() const;
 
-    [[nodiscard]] NBT_API reverse_iterator rbegin() noexcept;
-    [[nodiscard]] NBT_API reverse_iterator rend() noexcept;
+    [[nodiscard]] NBT_API reverse_iterator rbegin();
+    [[nodiscard]] NBT_API reverse_iterator rend();
 
-    [[nodiscard]] NBT_API const_reverse_iterator crbegin() const noexcept;
-    [[nodiscard]] NBT_API const_reverse_iterator crend() const noexcept;
+    [[nodiscard]] NBT_API const_reverse_iterator crbegin() const;
+    [[nodiscard]] NBT_API const_reverse_iterator crend() const;
 
-    NBT_API iterator erase(const_iterator where) noexcept;
-    NBT_API iterator erase(const_iterator first, const_iterator last) noexcept;
+    NBT_API iterator erase(const_iterator where);
+    NBT_API iterator erase(const_iterator first, const_iterator last);
 
     NBT_API bool set(size_t index, Tag const& tag);
     NBT_API bool set(size_t index, std::unique_ptr<Tag>&& tag);
     NBT_API bool set(size_t index, CompoundTagVariant tag);
+
+protected:
+    template <typename T>
+    static constexpr Type packedType() noexcept {
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            return Type::Byte;
+        } else if constexpr (std::is_same_v<T, int16_t>) {
+            return Type::Short;
+        } else if constexpr (std::is_same_v<T, int>) {
+            return Type::Int;
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            return Type::Long;
+        } else if constexpr (std::is_same_v<T, float>) {
+            return Type::Float;
+        } else {
+            static_assert(std::is_same_v<T, double>, "list element type cannot be packed");
+            return Type::Double;
+        }
+    }
+
+    [[nodiscard]] NBT_API std::span<std::byte>       packedStorage(Type type);
+    [[nodiscard]] NBT_API std::span<const std::byte> packedStorage(Type type) const;
 };
 
 } // namespace nbt
\ No newline at end of file
@@ -14,6 +14,8 @@ enum class NbtCompressionType : uint8_t {
     None = 0,
     Gzip = 1,
     Zlib = 2,
+    Zstd = 3,
+    LZ4  = 4,
 };
 
 } // namespace nbt
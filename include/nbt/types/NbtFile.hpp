@@ -7,13 +7,22 @@
 
 #pragma once
 #include <filesystem>
+#include <future>
+#include <memory>
+#include <nbt/types/NbtSaveMode.hpp>
 #include <nbt/types/TypedNbt.hpp>
 
 namespace nbt {
 
+namespace io {
+class SaveScheduler;
+} // namespace io
+
 class NbtFile : public TypedNbt {
 public:
-    std::filesystem::path mFilePath{};
+    std::filesystem::path              mFilePath{};
+    NbtSaveMode                        mSaveMode{NbtSaveMode::Atomic};
+    std::shared_ptr<io::SaveScheduler> mSaveScheduler{};
 
 public:
     NBT_API ~NbtFile();
@@ -32,7 +41,14 @@ public:
 
     NBT_API void setFilePath(std::filesystem::path const& filePath);
 
-    NBT_API void save() const;
+    NBT_API void setSaveMode(NbtSaveMode mode);
+
+    NBT_API void setSaveScheduler(std::shared_ptr<io::SaveScheduler> scheduler);
+
+    NBT_API std::shared_future<bool> save() const;
+
+protected:
+    std::shared_future<bool> enqueueSave(CompoundTag&& data) const;
 
 public:
     [[nodiscard]] NBT_API static std::optional<NbtFile> open(
@@ -0,0 +1,292 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <nbt/types/CompoundTagVariant.hpp>
+#include <nbt/types/NbtFileFormat.hpp>
+#include <span>
+
+namespace nbt {
+
+class CompoundView;
+class ListView;
+
+template <typename T>
+class ArrayView {
+public:
+    std::span<const std::byte> mData{};
+    size_t                     mSize{0};
+    NbtFileFormat              mFormat{NbtFileFormat::LittleEndian};
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T const*;
+        using reference         = T const&;
+
+        std::byte const* mCurrent{nullptr};
+        std::byte const* mNext{nullptr};
+        std::byte const* mEnd{nullptr};
+        NbtFileFormat    mFormat{NbtFileFormat::LittleEndian};
+        T                mValue{};
+
+        [[nodiscard]] constexpr Iterator() = default;
+        [[nodiscard]] Iterator(std::byte const* current, std::byte const* end, NbtFileFormat format) noexcept
+        : mCurrent(current),
+          mNext(current),
+          mEnd(end),
+          mFormat(format) {
+            decode();
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return mValue; }
+        [[nodiscard]] pointer   operator->() const noexcept { return std::addressof(mValue); }
+
+        Iterator& operator++() noexcept {
+            mCurrent = mNext;
+            decode();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(Iterator const& other) const noexcept { return mCurrent == other.mCurrent; }
+
+    private:
+        void decode() noexcept {
+            if (mCurrent >= mEnd) {
+                mCurrent = mEnd;
+                return;
+            }
+            if (mFormat == NbtFileFormat::BedrockNetwork) {
+                uint64_t result = 0;
+                for (unsigned shift = 0; mNext < mEnd && shift < 64; shift += 7) {
+                    auto byte  = static_cast<uint64_t>(*mNext++);
+                    result    |= (byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) { break; }
+                }
+                mValue = static_cast<T>(static_cast<T>(result >> 1) ^ -static_cast<T>(result & 1));
+            } else {
+                std::memcpy(&mValue, mCurrent, sizeof(T));
+                if ((mFormat == NbtFileFormat::LittleEndian) != (std::endian::native == std::endian::little)) {
+                    mValue = bstream::detail::swapEndian(mValue);
+                }
+                mNext = mCurrent + sizeof(T);
+            }
+        }
+    };
+
+    using iterator       = Iterator;
+    using const_iterator = Iterator;
+
+public:
+    [[nodiscard]] constexpr ArrayView() = default;
+    [[nodiscard]] constexpr ArrayView(std::span<const std::byte> data, size_t size, NbtFileFormat format) noexcept
+    : mData(data),
+      mSize(size),
+      mFormat(format) {}
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return mSize; }
+    [[nodiscard]] constexpr bool   empty() const noexcept { return mSize == 0; }
+
+    [[nodiscard]] constexpr std::span<const std::byte> bytes() const noexcept { return mData; }
+
+    [[nodiscard]] iterator begin() const noexcept {
+        return Iterator(mData.data(), mData.data() + mData.size(), mFormat);
+    }
+    [[nodiscard]] iterator end() const noexcept {
+        return Iterator(mData.data() + mData.size(), mData.data() + mData.size(), mFormat);
+    }
+
+    [[nodiscard]] std::vector<T> toVector() const {
+        std::vector<T> result;
+        result.reserve(mSize);
+        for (auto value : *this) { result.push_back(value); }
+        return result;
+    }
+};
+
+class NbtView {
+public:
+    std::string_view mData{};
+    Tag::Type        mType{Tag::Type::End};
+    NbtFileFormat    mFormat{NbtFileFormat::LittleEndian};
+
+public:
+    [[nodiscard]] constexpr NbtView() = default;
+    [[nodiscard]] NBT_API NbtView(std::string_view data, Tag::Type type, NbtFileFormat format) noexcept;
+
+    [[nodiscard]] constexpr Tag::Type getType() const noexcept { return mType; }
+    [[nodiscard]] constexpr bool      hold(Tag::Type type) const noexcept { return mType == type; }
+    [[nodiscard]] constexpr bool      is_null() const noexcept { return mType == Tag::Type::End; }
+
+    [[nodiscard]] NBT_API std::string_view payload() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<uint8_t> getByte() const noexcept;
+    [[nodiscard]] NBT_API std::optional<int16_t> getShort() const noexcept;
+    [[nodiscard]] NBT_API std::optional<int>     getInt() const noexcept;
+    [[nodiscard]] NBT_API std::optional<int64_t> getLong() const noexcept;
+    [[nodiscard]] NBT_API std::optional<float>   getFloat() const noexcept;
+    [[nodiscard]] NBT_API std::optional<double>  getDouble() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<std::string_view>         getString() const noexcept;
+    [[nodiscard]] NBT_API std::optional<std::span<const uint8_t>> getByteArray() const noexcept;
+    [[nodiscard]] NBT_API std::optional<ArrayView<int>>           getIntArray() const noexcept;
+    [[nodiscard]] NBT_API std::optional<ArrayView<int64_t>>       getLongArray() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<CompoundView> asCompound() const noexcept;
+    [[nodiscard]] NBT_API std::optional<ListView>     asList() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<CompoundTagVariant> materialize() const;
+
+    [[nodiscard]] NBT_API std::optional<NbtView> query(std::string_view path) const noexcept;
+
+    [[nodiscard]] NBT_API NbtView operator[](std::string_view key) const noexcept;
+    [[nodiscard]] NBT_API NbtView operator[](size_t index) const noexcept;
+
+    template <size_t N>
+    [[nodiscard]] NbtView operator[](char const (&key)[N]) const noexcept {
+        return operator[](std::string_view{key, N - 1});
+    }
+};
+
+class CompoundView : public NbtView {
+public:
+    using value_type = std::pair<std::string_view, NbtView>;
+
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = CompoundView::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = value_type const*;
+        using reference         = value_type const&;
+
+        std::string_view mData{};
+        size_t           mOffset{std::string_view::npos};
+        size_t           mNext{std::string_view::npos};
+        NbtFileFormat    mFormat{NbtFileFormat::LittleEndian};
+        value_type       mEntry{};
+
+        [[nodiscard]] constexpr Iterator() = default;
+        [[nodiscard]] NBT_API Iterator(std::string_view data, size_t offset, NbtFileFormat format) noexcept;
+
+        [[nodiscard]] reference operator*() const noexcept { return mEntry; }
+        [[nodiscard]] pointer   operator->() const noexcept { return std::addressof(mEntry); }
+
+        NBT_API Iterator& operator++() noexcept;
+
+        Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(Iterator const& other) const noexcept { return mOffset == other.mOffset; }
+    };
+
+    using iterator       = Iterator;
+    using const_iterator = Iterator;
+
+public:
+    [[nodiscard]] constexpr CompoundView() { mType = Tag::Type::Compound; }
+    [[nodiscard]] NBT_API CompoundView(std::string_view data, NbtFileFormat format) noexcept;
+
+    [[nodiscard]] NBT_API iterator begin() const noexcept;
+    [[nodiscard]] NBT_API iterator end() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<NbtView> find(std::string_view key) const noexcept;
+
+    [[nodiscard]] NBT_API bool contains(std::string_view key) const noexcept;
+    [[nodiscard]] NBT_API bool contains(std::string_view key, Tag::Type type) const noexcept;
+
+    [[nodiscard]] NBT_API size_t size() const noexcept;
+    [[nodiscard]] NBT_API bool   empty() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<CompoundTag> materialize() const;
+
+public:
+    [[nodiscard]] NBT_API static std::optional<CompoundView> fromNetworkNbt(std::string_view binaryData) noexcept;
+    [[nodiscard]] NBT_API static std::optional<CompoundView>
+    fromBinaryNbt(std::string_view binaryData, bool isLittleEndian = true) noexcept;
+    [[nodiscard]] NBT_API static std::optional<CompoundView>
+    fromBinaryNbtWithHeader(std::string_view binaryData, bool isLittleEndian = true) noexcept;
+    [[nodiscard]] NBT_API static std::optional<CompoundView> fromContent(
+        std::string_view             binaryData,
+        std::optional<NbtFileFormat> format          = std::nullopt,
+        bool                         strictMatchSize = true
+    ) noexcept;
+};
+
+class ListView : public NbtView {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = NbtView;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = value_type const*;
+        using reference         = value_type const&;
+
+        std::string_view mData{};
+        size_t           mOffset{std::string_view::npos};
+        size_t           mRemaining{0};
+        NbtView          mElement{};
+
+        [[nodiscard]] constexpr Iterator() = default;
+        [[nodiscard]] NBT_API
+        Iterator(std::string_view data, size_t offset, size_t remaining, Tag::Type type, NbtFileFormat format) noexcept;
+
+        [[nodiscard]] reference operator*() const noexcept { return mElement; }
+        [[nodiscard]] pointer   operator->() const noexcept { return std::addressof(mElement); }
+
+        NBT_API Iterator& operator++() noexcept;
+
+        Iterator operator++(int) noexcept {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(Iterator const& other) const noexcept { return mOffset == other.mOffset; }
+    };
+
+    using iterator       = Iterator;
+    using const_iterator = Iterator;
+
+public:
+    Tag::Type mElementType{Tag::Type::End};
+    size_t    mSize{0};
+    size_t    mElementsOffset{0};
+
+public:
+    [[nodiscard]] constexpr ListView() { mType = Tag::Type::List; }
+    [[nodiscard]] NBT_API ListView(std::string_view data, NbtFileFormat format) noexcept;
+
+    [[nodiscard]] constexpr Tag::Type getElementType() const noexcept { return mElementType; }
+    [[nodiscard]] constexpr size_t    size() const noexcept { return mSize; }
+    [[nodiscard]] constexpr bool      empty() const noexcept { return mSize == 0; }
+
+    [[nodiscard]] NBT_API iterator begin() const noexcept;
+    [[nodiscard]] NBT_API iterator end() const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<NbtView> at(size_t index) const noexcept;
+
+    [[nodiscard]] NBT_API std::optional<ListTag> materialize() const;
+};
+
+} // namespace nbt
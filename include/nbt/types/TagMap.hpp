@@ -0,0 +1,227 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <nbt-c/Macros.h>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nbt {
+
+class CompoundTagVariant;
+
+class TagMap {
+public:
+    using key_type        = std::string;
+    using mapped_type     = CompoundTagVariant;
+    using value_type      = std::pair<const std::string, CompoundTagVariant>;
+    using size_type       = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = value_type const&;
+    using Node            = std::unique_ptr<value_type>;
+    using Index           = std::vector<uint64_t>;
+
+    template <bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = TagMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, value_type const*, value_type*>;
+        using reference         = std::conditional_t<IsConst, value_type const&, value_type&>;
+
+    protected:
+        Node const* mNode{nullptr};
+        Node const* mEnd{nullptr};
+
+        friend class TagMap;
+        template <bool>
+        friend class Iterator;
+
+    public:
+        [[nodiscard]] Iterator() = default;
+        [[nodiscard]] Iterator(Node const* node, Node const* end) noexcept : mNode(node), mEnd(end) { skipErased(); }
+
+        [[nodiscard]] operator Iterator<true>() const noexcept
+            requires(!IsConst)
+        {
+            return Iterator<true>(mNode, mEnd);
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return *mNode->get(); }
+        [[nodiscard]] pointer   operator->() const noexcept { return mNode->get(); }
+
+        Iterator& operator++() noexcept {
+            ++mNode;
+            skipErased();
+            return *this;
+        }
+        Iterator operator++(int) noexcept {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        Iterator& operator--() noexcept {
+            do { --mNode; } while (!mNode->get());
+            return *this;
+        }
+        Iterator operator--(int) noexcept {
+            auto result = *this;
+            --*this;
+            return result;
+        }
+
+        template <bool OtherConst>
+        [[nodiscard]] bool operator==(Iterator<OtherConst> const& other) const noexcept {
+            return mNode == other.mNode;
+        }
+
+    protected:
+        void skipErased() noexcept {
+            while (mNode != mEnd && !mNode->get()) { ++mNode; }
+        }
+    };
+
+    using iterator               = Iterator<false>;
+    using const_iterator         = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_t   IndexThreshold = 16;
+    static constexpr size_t   npos           = static_cast<size_t>(-1);
+    static constexpr uint64_t PositionMask   = 0xFFFFFFFF;
+
+protected:
+    std::vector<Node>      mEntries{};
+    std::unique_ptr<Index> mIndex{};
+    size_t                 mSize{0};
+
+public:
+    [[nodiscard]] NBT_API TagMap();
+    [[nodiscard]] NBT_API TagMap(std::initializer_list<value_type> entries);
+
+    NBT_API ~TagMap();
+
+    [[nodiscard]] NBT_API TagMap(TagMap const& other);
+    [[nodiscard]] NBT_API TagMap(TagMap&& other) noexcept;
+
+    NBT_API TagMap& operator=(TagMap const& other);
+    NBT_API TagMap& operator=(TagMap&& other) noexcept;
+
+    [[nodiscard]] NBT_API iterator begin() noexcept;
+    [[nodiscard]] NBT_API iterator end() noexcept;
+
+    [[nodiscard]] NBT_API const_iterator begin() const noexcept;
+    [[nodiscard]] NBT_API const_iterator end() const noexcept;
+
+    [[nodiscard]] NBT_API const_iterator cbegin() const noexcept;
+    [[nodiscard]] NBT_API const_iterator cend() const noexcept;
+
+    [[nodiscard]] NBT_API reverse_iterator rbegin() noexcept;
+    [[nodiscard]] NBT_API reverse_iterator rend() noexcept;
+
+    [[nodiscard]] NBT_API const_reverse_iterator rbegin() const noexcept;
+    [[nodiscard]] NBT_API const_reverse_iterator rend() const noexcept;
+
+    [[nodiscard]] NBT_API const_reverse_iterator crbegin() const noexcept;
+    [[nodiscard]] NBT_API const_reverse_iterator crend() const noexcept;
+
+    [[nodiscard]] NBT_API size_t size() const noexcept;
+    [[nodiscard]] NBT_API size_t max_size() const noexcept;
+    [[nodiscard]] NBT_API bool   empty() const noexcept;
+
+    NBT_API void reserve(size_t size);
+    NBT_API void clear() noexcept;
+    NBT_API void swap(TagMap& other) noexcept;
+
+    [[nodiscard]] NBT_API iterator       find(std::string_view key) noexcept;
+    [[nodiscard]] NBT_API const_iterator find(std::string_view key) const noexcept;
+
+    [[nodiscard]] NBT_API bool   contains(std::string_view key) const noexcept;
+    [[nodiscard]] NBT_API size_t count(std::string_view key) const noexcept;
+
+    [[nodiscard]] NBT_API iterator       lower_bound(std::string_view key) noexcept;
+    [[nodiscard]] NBT_API const_iterator lower_bound(std::string_view key) const noexcept;
+    [[nodiscard]] NBT_API iterator       upper_bound(std::string_view key) noexcept;
+    [[nodiscard]] NBT_API const_iterator upper_bound(std::string_view key) const noexcept;
+
+    [[nodiscard]] NBT_API CompoundTagVariant&       at(std::string_view key);
+    [[nodiscard]] NBT_API CompoundTagVariant const& at(std::string_view key) const;
+
+    [[nodiscard]] NBT_API CompoundTagVariant& operator[](std::string_view key);
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(std::string_view key, Args&&... args) {
+        auto hash = mIndex ? hashKey(key) : 0;
+        if (auto position = findIndex(key, hash); position != npos) { return {iteratorAt(position), false}; }
+        auto node = std::make_unique<value_type>(
+            std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+        return {appendNode(std::move(node), hash), true};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insertNode(std::make_unique<value_type>(std::forward<Args>(args)...));
+    }
+
+    template <typename T>
+    std::pair<iterator, bool> insert_or_assign(std::string_view key, T&& value) {
+        if (auto position = findIndex(key); position != npos) {
+            valueAt(position) = std::forward<T>(value);
+            return {iteratorAt(position), false};
+        }
+        return try_emplace(key, std::forward<T>(value));
+    }
+
+    NBT_API std::pair<iterator, bool> insert(value_type const& value);
+    NBT_API std::pair<iterator, bool> insert(value_type&& value);
+    NBT_API void                      insert(std::initializer_list<value_type> entries);
+
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) { emplace(*first); }
+    }
+
+    NBT_API iterator erase(const_iterator where);
+    NBT_API iterator erase(const_iterator first, const_iterator last);
+    NBT_API size_t   erase(std::string_view key);
+
+    NBT_API bool rename(std::string_view key, std::string_view newKey);
+
+protected:
+    [[nodiscard]] NBT_API static uint64_t hashKey(std::string_view key) noexcept;
+
+    [[nodiscard]] NBT_API size_t findIndex(std::string_view key) const noexcept;
+    [[nodiscard]] NBT_API size_t findIndex(std::string_view key, uint64_t hash) const noexcept;
+    [[nodiscard]] NBT_API size_t findBound(std::string_view key, bool inclusive) const noexcept;
+
+    [[nodiscard]] NBT_API iterator            iteratorAt(size_t position) noexcept;
+    [[nodiscard]] NBT_API CompoundTagVariant& valueAt(size_t position) noexcept;
+
+    NBT_API iterator                  appendNode(Node&& node, uint64_t hash);
+    NBT_API std::pair<iterator, bool> insertNode(Node&& node);
+
+    void   removeAt(size_t position) noexcept;
+    size_t compact(size_t position);
+    void   rebuildIndex();
+    void   placeIndex(size_t position, uint64_t hash) noexcept;
+    void   removeIndex(size_t position) noexcept;
+};
+
+} // namespace nbt
@@ -13,6 +13,24 @@ inline nbtio_buffer* make_nbtio_buffer(std::string_view buffer) {
     return result;
 }
 
+inline nbtio_buffer* allocate_nbtio_buffer(size_t size) {
+    auto result  = new nbtio_buffer();
+    result->data = new uint8_t[size];
+    result->size = size;
+    return result;
+}
+
+inline nbtio_buffer* write_nbtio_buffer(nbt::CompoundTag const& nbt, nbt::NbtFileFormat format) {
+    auto result  = allocate_nbtio_buffer(nbt.computeBinarySize(format));
+    auto written = nbt.writeTo(std::as_writable_bytes(std::span(result->data, result->size)), format);
+    if (!written) {
+        nbtio_buffer_free(result);
+        return nullptr;
+    }
+    result->size = *written;
+    return result;
+}
+
 inline nbtio_buffer* make_nbtio_buffer(std::vector<uint8_t> const& buffer) {
     auto result  = new nbtio_buffer();
     result->data = new uint8_t[buffer.size()];
@@ -342,17 +360,21 @@ void nbt_compound_tag_clear(void* handle) {
 
 nbtio_buffer* nbt_compound_tag_to_binary_nbt(void* handle, bool little_endian, bool write_header) {
     if (handle) {
-        std::string value = write_header ? toTag(handle)->as<nbt::CompoundTag>().toBinaryNbtWithHeader(little_endian)
-                                         : toTag(handle)->as<nbt::CompoundTag>().toBinaryNbt(little_endian);
-        return make_nbtio_buffer(value);
+        auto& nbt    = toTag(handle)->as<nbt::CompoundTag>();
+        auto  format = little_endian ? (write_header ? nbt::NbtFileFormat::LittleEndianWithHeader
+                                                     : nbt::NbtFileFormat::LittleEndian)
+                                     : (write_header ? nbt::NbtFileFormat::BigEndianWithHeader
+                                                     : nbt::NbtFileFormat::BigEndian);
+        return write_nbtio_buffer(nbt, format);
     }
     return nullptr;
 }
 
 nbtio_buffer* nbt_compound_tag_to_network_nbt(void* handle) {
     if (handle) {
-        std::string value = toTag(handle)->as<nbt::CompoundTag>().toNetworkNbt();
-        return make_nbtio_buffer(value);
+        auto& nbt    = toTag(handle)->as<nbt::CompoundTag>();
+        auto  format = nbt::NbtFileFormat::BedrockNetwork;
+        return write_nbtio_buffer(nbt, format);
     }
     return nullptr;
 }
@@ -541,4 +563,8 @@ NBT_CompressionType nbt_detect_content_compression_type(const uint8_t* data, siz
         nbt::io::detectContentCompressionType(std::string_view(reinterpret_cast<const char*>(data), size))
     );
 }
+
+bool nbt_is_compression_supported(NBT_CompressionType type) {
+    return nbt::io::isCompressionSupported(static_cast<nbt::NbtCompressionType>(type));
+}
 }
\ No newline at end of file
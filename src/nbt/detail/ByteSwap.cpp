@@ -0,0 +1,111 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/detail/ByteSwap.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NBT_BYTESWAP_AVX2
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define NBT_BYTESWAP_SSSE3
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define NBT_BYTESWAP_NEON
+#endif
+
+namespace nbt::detail {
+
+namespace {
+
+template <typename T>
+void byteSwapScalar(unsigned char* data, size_t count) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        T value;
+        std::memcpy(&value, data + (i * sizeof(T)), sizeof(T));
+        value = std::byteswap(value);
+        std::memcpy(data + (i * sizeof(T)), &value, sizeof(T));
+    }
+}
+
+#if defined(NBT_BYTESWAP_AVX2) || defined(NBT_BYTESWAP_SSSE3)
+template <size_t Width>
+constexpr std::array<char, 16> shuffleMask() noexcept {
+    std::array<char, 16> mask{};
+    for (size_t i = 0; i < mask.size(); i++) {
+        mask[i] = static_cast<char>((i / Width * Width) + (Width - 1 - (i % Width)));
+    }
+    return mask;
+}
+#endif
+
+template <typename T>
+void byteSwapBlock(unsigned char* data, size_t count) noexcept {
+    size_t bytes  = count * sizeof(T);
+    size_t offset = 0;
+#if defined(NBT_BYTESWAP_AVX2)
+    static constexpr auto mask128 = shuffleMask<sizeof(T)>();
+    auto mask = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask128.data())));
+    for (; offset + 32 <= bytes; offset += 32) {
+        auto block = reinterpret_cast<__m256i*>(data + offset);
+        _mm256_storeu_si256(block, _mm256_shuffle_epi8(_mm256_loadu_si256(block), mask));
+    }
+#elif defined(NBT_BYTESWAP_SSSE3)
+    static constexpr auto mask128 = shuffleMask<sizeof(T)>();
+    auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask128.data()));
+    for (; offset + 16 <= bytes; offset += 16) {
+        auto block = reinterpret_cast<__m128i*>(data + offset);
+        _mm_storeu_si128(block, _mm_shuffle_epi8(_mm_loadu_si128(block), mask));
+    }
+#elif defined(NBT_BYTESWAP_NEON)
+    for (; offset + 16 <= bytes; offset += 16) {
+        auto block = vld1q_u8(data + offset);
+        if constexpr (sizeof(T) == 2) {
+            block = vrev16q_u8(block);
+        } else if constexpr (sizeof(T) == 4) {
+            block = vrev32q_u8(block);
+        } else {
+            block = vrev64q_u8(block);
+        }
+        vst1q_u8(data + offset, block);
+    }
+#endif
+    byteSwapScalar<T>(data + offset, (bytes - offset) / sizeof(T));
+}
+
+} // namespace
+
+void byteSwap16(void* data, size_t count) noexcept {
+    byteSwapBlock<uint16_t>(static_cast<unsigned char*>(data), count);
+}
+
+void byteSwap32(void* data, size_t count) noexcept {
+    byteSwapBlock<uint32_t>(static_cast<unsigned char*>(data), count);
+}
+
+void byteSwap64(void* data, size_t count) noexcept {
+    byteSwapBlock<uint64_t>(static_cast<unsigned char*>(data), count);
+}
+
+void byteSwap(void* data, size_t count, size_t elementSize) noexcept {
+    switch (elementSize) {
+    case sizeof(uint16_t):
+        return byteSwap16(data, count);
+    case sizeof(uint32_t):
+        return byteSwap32(data, count);
+    case sizeof(uint64_t):
+        return byteSwap64(data, count);
+    default:
+        return;
+    }
+}
+
+} // namespace nbt::detail
@@ -0,0 +1,21 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include <cstddef>
+
+namespace nbt::detail {
+
+void byteSwap16(void* data, size_t count) noexcept;
+
+void byteSwap32(void* data, size_t count) noexcept;
+
+void byteSwap64(void* data, size_t count) noexcept;
+
+void byteSwap(void* data, size_t count, size_t elementSize) noexcept;
+
+} // namespace nbt::detail
@@ -6,91 +6,715 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/detail/CompressionUtils.hpp"
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
 #include <zlib.h>
 
+#if defined(NBT_USE_LIBDEFLATE)
+#include <libdeflate.h>
+#endif
+#if defined(NBT_USE_ZSTD)
+#include <zstd.h>
+#endif
+#if defined(NBT_USE_LZ4)
+#include <lz4frame.h>
+#endif
+
 namespace nbt::detail {
 
 static constexpr size_t ZLIB_STREAM_CHUNK = 65536;
 
-std::string compress(std::string_view input, int level, int windowBits) {
-    if (input.empty()) { return std::string(); }
+namespace {
 
-    z_stream strm{};
-    strm.zalloc = Z_NULL;
-    strm.zfree  = Z_NULL;
-    strm.opaque = Z_NULL;
+constexpr size_t MAX_PRESIZE_RATIO = 1032;
 
-    if (deflateInit2(&strm, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
-        return std::string(input);
+int getWindowBits(NbtCompressionType type) noexcept {
+    return type == NbtCompressionType::Gzip ? 15 + 16 : 15; // GZIP : ZLIB
+}
+
+uint64_t readLittleEndian(std::string_view input, size_t offset, size_t size) noexcept {
+    uint64_t result = 0;
+    for (size_t i = 0; i < size; i++) {
+        result |= static_cast<uint64_t>(static_cast<uint8_t>(input[offset + i])) << (i * 8);
     }
+    return result;
+}
 
+std::optional<uint64_t> getDeclaredSize(std::string_view input, NbtCompressionType type) noexcept {
+    switch (type) {
+    case NbtCompressionType::Gzip: {
+        if (input.size() < 18) { return std::nullopt; }
+        return readLittleEndian(input, input.size() - 4, 4);
+    }
+#if defined(NBT_USE_ZSTD)
+    case NbtCompressionType::Zstd: {
+        auto size = ZSTD_getFrameContentSize(input.data(), input.size());
+        if (size == ZSTD_CONTENTSIZE_ERROR || size == ZSTD_CONTENTSIZE_UNKNOWN) { return std::nullopt; }
+        return size;
+    }
+#endif
+    case NbtCompressionType::LZ4: {
+        if (input.size() < 14 || (static_cast<uint8_t>(input[4]) & 0x08) == 0) { return std::nullopt; }
+        return readLittleEndian(input, 6, 8);
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+size_t getExpectedSize(std::string_view input, NbtCompressionType type) noexcept {
+    auto limit = input.size() * MAX_PRESIZE_RATIO;
+    if (auto size = getDeclaredSize(input, type); size && *size > 0 && *size <= limit) {
+        return static_cast<size_t>(*size);
+    }
+    return std::min(std::max(input.size() * 4, ZLIB_STREAM_CHUNK), limit);
+}
+
+template <bool IsDeflate>
+class ZlibContext {
+public:
+    z_stream mStream{};
+    int      mWindowBits{0};
+    int      mLevel{0};
+    bool     mInitialized{false};
+    bool     mInUse{false};
+
+public:
+    ZlibContext() = default;
+
+    ~ZlibContext() { end(); }
+
+    ZlibContext(ZlibContext const&)            = delete;
+    ZlibContext& operator=(ZlibContext const&) = delete;
+
+    bool prepare(int windowBits, int level) {
+        if (mInitialized && mWindowBits == windowBits) {
+            if constexpr (IsDeflate) {
+                if (deflateReset(&mStream) != Z_OK) { return false; }
+                if (mLevel != level && deflateParams(&mStream, level, Z_DEFAULT_STRATEGY) != Z_OK) { return false; }
+            } else if (inflateReset(&mStream) != Z_OK) {
+                return false;
+            }
+        } else {
+            end();
+            if constexpr (IsDeflate) {
+                mInitialized = deflateInit2(&mStream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+            } else {
+                mInitialized = inflateInit2(&mStream, windowBits) == Z_OK;
+            }
+            if (!mInitialized) { return false; }
+        }
+        mWindowBits = windowBits;
+        mLevel      = level;
+        return true;
+    }
+
+private:
+    void end() noexcept {
+        if (!mInitialized) { return; }
+        if constexpr (IsDeflate) {
+            deflateEnd(&mStream);
+        } else {
+            inflateEnd(&mStream);
+        }
+        mInitialized = false;
+    }
+};
+
+template <bool IsDeflate>
+class ZlibLease {
+public:
+    ZlibContext<IsDeflate>  mOwned;
+    ZlibContext<IsDeflate>* mContext;
+    bool                    mReady;
+
+public:
+    ZlibLease(int windowBits, int level, bool shareContext)
+    : mContext(shareContext ? &sharedContext(windowBits) : &mOwned) {
+        if (mContext->mInUse) { mContext = &mOwned; }
+        mContext->mInUse = true;
+        mReady           = mContext->prepare(windowBits, level);
+    }
+
+    ~ZlibLease() { mContext->mInUse = false; }
+
+    ZlibLease(ZlibLease const&)            = delete;
+    ZlibLease& operator=(ZlibLease const&) = delete;
+
+    [[nodiscard]] bool isReady() const noexcept { return mReady; }
+
+    [[nodiscard]] z_stream& get() noexcept { return mContext->mStream; }
+
+private:
+    static ZlibContext<IsDeflate>& sharedContext(int windowBits) {
+        thread_local std::array<ZlibContext<IsDeflate>, 2> contexts;
+        return contexts[windowBits > 15 ? 1 : 0];
+    }
+};
+
+std::string zlibCompress(std::string_view input, int level, int windowBits) {
+    ZlibLease<true> lease(windowBits, level, true);
+    if (!lease.isReady()) { return std::string(input); }
+
+    auto& strm    = lease.get();
     strm.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
     strm.avail_in = static_cast<uInt>(input.size());
 
     std::string output;
-    Bytef       out_buffer[ZLIB_STREAM_CHUNK];
-    int         ret;
+    output.resize(deflateBound(&strm, static_cast<uLong>(input.size())));
+    strm.next_out  = reinterpret_cast<Bytef*>(output.data());
+    strm.avail_out = static_cast<uInt>(output.size());
+
+    if (deflate(&strm, Z_FINISH) != Z_STREAM_END) { return std::string(input); }
+    output.resize(strm.total_out);
+    return output;
+}
 
-    do {
-        strm.next_out  = out_buffer;
-        strm.avail_out = ZLIB_STREAM_CHUNK;
+#if defined(NBT_USE_LIBDEFLATE)
+std::optional<std::string> libdeflateCompress(std::string_view input, NbtCompressionType type, int level) {
+    std::unique_ptr<libdeflate_compressor, decltype(&libdeflate_free_compressor)> compressor(
+        libdeflate_alloc_compressor(level < 0 ? 6 : level),
+        &libdeflate_free_compressor
+    );
+    if (!compressor) { return std::nullopt; }
+    auto isGzip   = type == NbtCompressionType::Gzip;
+    auto bound    = isGzip ? &libdeflate_gzip_compress_bound : &libdeflate_zlib_compress_bound;
+    auto compress = isGzip ? &libdeflate_gzip_compress : &libdeflate_zlib_compress;
+    std::string output;
+    output.resize(bound(compressor.get(), input.size()));
+    auto size = compress(compressor.get(), input.data(), input.size(), output.data(), output.size());
+    if (size == 0) { return std::nullopt; }
+    output.resize(size);
+    return output;
+}
 
-        ret = deflate(&strm, Z_FINISH);
-        if (ret == Z_STREAM_ERROR) { break; }
+std::optional<std::string> libdeflateDecompress(std::string_view input, NbtCompressionType type) {
+    thread_local std::unique_ptr<libdeflate_decompressor, decltype(&libdeflate_free_decompressor)> decompressor(
+        libdeflate_alloc_decompressor(),
+        &libdeflate_free_decompressor
+    );
+    if (!decompressor) { return std::nullopt; }
+    auto decompress = type == NbtCompressionType::Gzip ? &libdeflate_gzip_decompress : &libdeflate_zlib_decompress;
+    std::string output;
+    output.resize(getExpectedSize(input, type));
+    while (true) {
+        size_t size   = 0;
+        auto   result = decompress(decompressor.get(), input.data(), input.size(), output.data(), output.size(), &size);
+        if (result == LIBDEFLATE_SUCCESS) {
+            output.resize(size);
+            return output;
+        }
+        if (result != LIBDEFLATE_INSUFFICIENT_SPACE) { return std::nullopt; }
+        output.resize(output.size() * 2);
+    }
+}
+#endif
 
-        size_t have = ZLIB_STREAM_CHUNK - strm.avail_out;
-        output.append(reinterpret_cast<char*>(out_buffer), have);
-    } while (strm.avail_out == 0);
+#if defined(NBT_USE_ZSTD)
+std::optional<std::string> zstdCompress(std::string_view input, int level) {
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+    if (!context) { return std::nullopt; }
+    std::string output;
+    output.resize(ZSTD_compressBound(input.size()));
+    auto size = ZSTD_compressCCtx(
+        context.get(),
+        output.data(),
+        output.size(),
+        input.data(),
+        input.size(),
+        level < 0 ? ZSTD_CLEVEL_DEFAULT : level
+    );
+    if (ZSTD_isError(size)) { return std::nullopt; }
+    output.resize(size);
+    return output;
+}
+#endif
 
-    deflateEnd(&strm);
-    return (ret == Z_STREAM_END) ? output : std::string(input);
+#if defined(NBT_USE_LZ4)
+std::optional<std::string> lz4Compress(std::string_view input, int level) {
+    LZ4F_preferences_t preferences{};
+    preferences.frameInfo.contentSize = input.size();
+    preferences.compressionLevel      = std::max(level, 0);
+    std::string output;
+    output.resize(LZ4F_compressFrameBound(input.size(), &preferences));
+    auto size = LZ4F_compressFrame(output.data(), output.size(), input.data(), input.size(), &preferences);
+    if (LZ4F_isError(size)) { return std::nullopt; }
+    output.resize(size);
+    return output;
 }
+#endif
 
-std::string decompress(std::string_view input) {
-    if (input.size() < 2) { return std::string(input); }
+class Decompressor {
+public:
+    ByteSource         mSource;
+    std::string        mBuffer;
+    std::string_view   mAvailable;
+    NbtCompressionType mType{NbtCompressionType::None};
+    bool               mShareContext;
+    std::optional<ZlibLease<false>> mZlib{};
+#if defined(NBT_USE_ZSTD)
+    ZSTD_DStream* mZstdStream{nullptr};
+#endif
+#if defined(NBT_USE_LZ4)
+    LZ4F_dctx* mLz4Context{nullptr};
+#endif
+    bool mReady{false};
+    bool mFinished{false};
+    bool mComplete{false};
+
+public:
+    Decompressor(std::string_view input, ByteSource source, size_t bufferSize, bool shareContext)
+    : mSource(std::move(source)),
+      mAvailable(input),
+      mShareContext(shareContext) {
+        if (mSource) {
+            mBuffer.resize(std::max<size_t>(bufferSize, 4));
+            while (mAvailable.size() < 4 && refill(mAvailable.size())) {}
+        }
+        mType     = detectCompressionType(mAvailable);
+        mReady    = mType != NbtCompressionType::None && init();
+        mFinished = mType != NbtCompressionType::None && !mReady;
+    }
+
+    ~Decompressor() {
+        if (!mReady) { return; }
+        switch (mType) {
+#if defined(NBT_USE_ZSTD)
+        case NbtCompressionType::Zstd:
+            ZSTD_freeDStream(mZstdStream);
+            break;
+#endif
+#if defined(NBT_USE_LZ4)
+        case NbtCompressionType::LZ4:
+            LZ4F_freeDecompressionContext(mLz4Context);
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+
+    Decompressor(Decompressor const&)            = delete;
+    Decompressor& operator=(Decompressor const&) = delete;
 
-    const uint8_t* data = reinterpret_cast<const uint8_t*>(input.data());
-    uint8_t        b0   = data[0];
-    uint8_t        b1   = data[1];
+    [[nodiscard]] bool isFinished() const noexcept { return mFinished; }
 
-    int windowBits = 0;
+    [[nodiscard]] bool isComplete() const noexcept { return mComplete; }
 
+    size_t read(char* buffer, size_t size) {
+        if (mFinished || size == 0) { return 0; }
+        if (mType == NbtCompressionType::None) { return passThrough(buffer, size); }
+        size_t produced = 0;
+        while (produced < size && !mFinished) {
+            if (mAvailable.empty()) { refill(0); }
+            auto available  = mAvailable.size();
+            auto length     = step(buffer + produced, size - produced);
+            produced       += length;
+            if (length == 0 && mAvailable.size() == available) { mFinished = true; }
+        }
+        return produced;
+    }
+
+private:
+    bool init() {
+        switch (mType) {
+        case NbtCompressionType::Gzip:
+        case NbtCompressionType::Zlib:
+            mZlib.emplace(getWindowBits(mType), 0, mShareContext);
+            return mZlib->isReady();
+#if defined(NBT_USE_ZSTD)
+        case NbtCompressionType::Zstd:
+            mZstdStream = ZSTD_createDStream();
+            return mZstdStream != nullptr;
+#endif
+#if defined(NBT_USE_LZ4)
+        case NbtCompressionType::LZ4:
+            return !LZ4F_isError(LZ4F_createDecompressionContext(&mLz4Context, LZ4F_VERSION));
+#endif
+        default:
+            return false;
+        }
+    }
+
+    void finish(bool complete) noexcept {
+        mFinished = true;
+        mComplete = complete;
+    }
+
+    size_t step(char* buffer, size_t size) {
+        switch (mType) {
+        case NbtCompressionType::Gzip:
+        case NbtCompressionType::Zlib: {
+            auto& stream     = mZlib->get();
+            stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(mAvailable.data()));
+            stream.avail_in  = static_cast<uInt>(std::min<size_t>(mAvailable.size(), UINT32_MAX));
+            stream.next_out  = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = static_cast<uInt>(std::min<size_t>(size, UINT32_MAX));
+            auto consumed    = stream.avail_in;
+            auto available   = stream.avail_out;
+            auto ret         = inflate(&stream, Z_NO_FLUSH);
+            mAvailable.remove_prefix(consumed - stream.avail_in);
+            if (ret == Z_STREAM_END) {
+                finish(true);
+            } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+                finish(false);
+            }
+            return available - stream.avail_out;
+        }
+#if defined(NBT_USE_ZSTD)
+        case NbtCompressionType::Zstd: {
+            ZSTD_inBuffer  in{mAvailable.data(), mAvailable.size(), 0};
+            ZSTD_outBuffer out{buffer, size, 0};
+            auto           ret = ZSTD_decompressStream(mZstdStream, &out, &in);
+            mAvailable.remove_prefix(in.pos);
+            if (ZSTD_isError(ret)) {
+                finish(false);
+            } else if (ret == 0) {
+                finish(true);
+            }
+            return out.pos;
+        }
+#endif
+#if defined(NBT_USE_LZ4)
+        case NbtCompressionType::LZ4: {
+            size_t produced = size;
+            size_t consumed = mAvailable.size();
+            auto   ret      = LZ4F_decompress(mLz4Context, buffer, &produced, mAvailable.data(), &consumed, nullptr);
+            mAvailable.remove_prefix(consumed);
+            if (LZ4F_isError(ret)) {
+                finish(false);
+            } else if (ret == 0) {
+                finish(true);
+            }
+            return produced;
+        }
+#endif
+        default:
+            finish(false);
+            return 0;
+        }
+    }
+
+    bool refill(size_t kept) {
+        if (!mSource) { return false; }
+        if (kept > 0) { std::memmove(mBuffer.data(), mAvailable.data(), kept); }
+        auto length = mSource(mBuffer.data() + kept, mBuffer.size() - kept);
+        mAvailable  = std::string_view(mBuffer.data(), kept + length);
+        return length > 0;
+    }
+
+    size_t passThrough(char* buffer, size_t size) {
+        if (mAvailable.empty()) { return mSource ? mSource(buffer, size) : 0; }
+        auto length = std::min(size, mAvailable.size());
+        std::memcpy(buffer, mAvailable.data(), length);
+        mAvailable.remove_prefix(length);
+        return length;
+    }
+};
+
+ByteSource makeDecompressSource(std::shared_ptr<Decompressor> state) {
+    return [state = std::move(state)](char* buffer, size_t size) { return state->read(buffer, size); };
+}
+
+} // namespace
+
+NbtCompressionType detectCompressionType(std::string_view input) noexcept {
+    if (input.size() < 2) { return NbtCompressionType::None; }
+    auto b0 = static_cast<uint8_t>(input[0]);
+    auto b1 = static_cast<uint8_t>(input[1]);
     if (b0 == 0x1F && b1 == 0x8B) {
-        windowBits = 15 + 16; // GZIP
+        return NbtCompressionType::Gzip;
     } else if (b0 == 0x78 && (b1 == 0x01 || b1 == 0x9C || b1 == 0xDA)) {
-        windowBits = 15; // ZLIB
-    } else {
+        return NbtCompressionType::Zlib;
+    } else if (input.size() >= 4) {
+        auto magic = readLittleEndian(input, 0, 4);
+        if (magic == 0xFD2FB528) {
+            return NbtCompressionType::Zstd;
+        } else if (magic == 0x184D2204) {
+            return NbtCompressionType::LZ4;
+        }
+    }
+    return NbtCompressionType::None;
+}
+
+bool isCompressionSupported(NbtCompressionType type) noexcept {
+    switch (type) {
+    case NbtCompressionType::None:
+    case NbtCompressionType::Gzip:
+    case NbtCompressionType::Zlib:
+        return true;
+#if defined(NBT_USE_ZSTD)
+    case NbtCompressionType::Zstd:
+        return true;
+#endif
+#if defined(NBT_USE_LZ4)
+    case NbtCompressionType::LZ4:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+std::string compress(std::string_view input, NbtCompressionType type, int level) {
+    if (input.empty()) { return std::string(); }
+    switch (type) {
+    case NbtCompressionType::None:
         return std::string(input);
+    case NbtCompressionType::Gzip:
+    case NbtCompressionType::Zlib: {
+#if defined(NBT_USE_LIBDEFLATE)
+        if (auto output = libdeflateCompress(input, type, level)) { return std::move(*output); }
+#endif
+        return zlibCompress(input, level, getWindowBits(type));
+    }
+#if defined(NBT_USE_ZSTD)
+    case NbtCompressionType::Zstd: {
+        if (auto output = zstdCompress(input, level)) { return std::move(*output); }
+        break;
+    }
+#endif
+#if defined(NBT_USE_LZ4)
+    case NbtCompressionType::LZ4: {
+        if (auto output = lz4Compress(input, level)) { return std::move(*output); }
+        break;
+    }
+#endif
+    default:
+        break;
     }
+    return std::string();
+}
+
+std::string decompress(std::string_view input) {
+    auto type = detectCompressionType(input);
+    if (type == NbtCompressionType::None) { return std::string(input); }
+#if defined(NBT_USE_LIBDEFLATE)
+    if (type == NbtCompressionType::Gzip || type == NbtCompressionType::Zlib) {
+        if (auto output = libdeflateDecompress(input, type)) { return std::move(*output); }
+        return std::string(input);
+    }
+#endif
+    Decompressor decompressor(input, nullptr, 0, true);
+    std::string  output;
+    size_t       have = 0;
+    output.resize(getExpectedSize(input, type));
+    while (!decompressor.isFinished()) {
+        if (have == output.size()) { output.resize(output.size() * 2); }
+        have += decompressor.read(output.data() + have, output.size() - have);
+    }
+    if (!decompressor.isComplete()) { return std::string(input); }
+    output.resize(have);
+    return output;
+}
 
-    z_stream zstr{};
-    zstr.zalloc = Z_NULL;
-    zstr.zfree  = Z_NULL;
-    zstr.opaque = Z_NULL;
+class CompressStream::State {
+public:
+    ByteSink                       mSink;
+    NbtCompressionType             mType;
+    std::string                    mBuffer;
+    std::optional<ZlibLease<true>> mZlib{};
+#if defined(NBT_USE_ZSTD)
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> mZstdContext{nullptr, &ZSTD_freeCCtx};
+#endif
+#if defined(NBT_USE_LZ4)
+    std::unique_ptr<LZ4F_cctx, decltype(&LZ4F_freeCompressionContext)> mLz4Context{
+        nullptr,
+        &LZ4F_freeCompressionContext
+    };
+#endif
+    bool mFailed{false};
 
-    if (inflateInit2(&zstr, windowBits) != Z_OK) { return std::string(input); }
+public:
+    State(NbtCompressionType type, int level, ByteSink sink) : mSink(std::move(sink)), mType(type) {
+        mBuffer.resize(ZLIB_STREAM_CHUNK);
+        if (!init(level)) {
+            mFailed = mType != NbtCompressionType::None;
+            mType   = NbtCompressionType::None;
+        }
+    }
 
-    zstr.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
-    zstr.avail_in = static_cast<uInt>(input.size());
+    [[nodiscard]] bool isReady() const noexcept { return !mFailed; }
 
-    std::string output;
-    Bytef       out_buffer[ZLIB_STREAM_CHUNK];
-    int         ret;
+    void write(std::string_view data) {
+        switch (mType) {
+        case NbtCompressionType::Gzip:
+        case NbtCompressionType::Zlib: {
+            auto& stream = mZlib->get();
+            while (!data.empty() && !mFailed) {
+                auto length     = std::min<size_t>(data.size(), UINT32_MAX);
+                stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+                stream.avail_in = static_cast<uInt>(length);
+                do {
+                    if (deflate(&stream, Z_NO_FLUSH) == Z_STREAM_ERROR) { mFailed = true; }
+                } while (emitZlib() && !mFailed);
+                data.remove_prefix(length);
+            }
+            break;
+        }
+#if defined(NBT_USE_ZSTD)
+        case NbtCompressionType::Zstd: {
+            ZSTD_inBuffer in{data.data(), data.size(), 0};
+            while (in.pos < in.size && !mFailed) {
+                ZSTD_outBuffer out{mBuffer.data(), mBuffer.size(), 0};
+                if (ZSTD_isError(ZSTD_compressStream2(mZstdContext.get(), &out, &in, ZSTD_e_continue))) {
+                    mFailed = true;
+                }
+                emit(out.pos);
+            }
+            break;
+        }
+#endif
+#if defined(NBT_USE_LZ4)
+        case NbtCompressionType::LZ4: {
+            while (!data.empty() && !mFailed) {
+                auto length = std::min(data.size(), ZLIB_STREAM_CHUNK);
+                auto size   = LZ4F_compressUpdate(
+                    mLz4Context.get(),
+                    mBuffer.data(),
+                    mBuffer.size(),
+                    data.data(),
+                    length,
+                    nullptr
+                );
+                emitLz4(size);
+                data.remove_prefix(length);
+            }
+            break;
+        }
+#endif
+        default:
+            if (!mFailed) { mSink(data); }
+            break;
+        }
+    }
+
+    bool finish() {
+        switch (mType) {
+        case NbtCompressionType::Gzip:
+        case NbtCompressionType::Zlib: {
+            auto& stream    = mZlib->get();
+            stream.next_in  = Z_NULL;
+            stream.avail_in = 0;
+            auto ret        = Z_OK;
+            while (ret == Z_OK) {
+                ret = deflate(&stream, Z_FINISH);
+                emitZlib();
+            }
+            if (ret != Z_STREAM_END) { mFailed = true; }
+            break;
+        }
+#if defined(NBT_USE_ZSTD)
+        case NbtCompressionType::Zstd: {
+            ZSTD_inBuffer in{nullptr, 0, 0};
+            size_t        remaining = 1;
+            while (remaining != 0 && !mFailed) {
+                ZSTD_outBuffer out{mBuffer.data(), mBuffer.size(), 0};
+                remaining = ZSTD_compressStream2(mZstdContext.get(), &out, &in, ZSTD_e_end);
+                if (ZSTD_isError(remaining)) { mFailed = true; }
+                emit(out.pos);
+            }
+            break;
+        }
+#endif
+#if defined(NBT_USE_LZ4)
+        case NbtCompressionType::LZ4: {
+            emitLz4(LZ4F_compressEnd(mLz4Context.get(), mBuffer.data(), mBuffer.size(), nullptr));
+            break;
+        }
+#endif
+        default:
+            break;
+        }
+        return !mFailed;
+    }
 
-    do {
-        zstr.next_out  = out_buffer;
-        zstr.avail_out = ZLIB_STREAM_CHUNK;
+private:
+    bool init(int level) {
+        switch (mType) {
+        case NbtCompressionType::Gzip:
+        case NbtCompressionType::Zlib:
+            mZlib.emplace(getWindowBits(mType), level, true);
+            if (!mZlib->isReady()) { return false; }
+            mZlib->get().next_out  = reinterpret_cast<Bytef*>(mBuffer.data());
+            mZlib->get().avail_out = static_cast<uInt>(mBuffer.size());
+            return true;
+#if defined(NBT_USE_ZSTD)
+        case NbtCompressionType::Zstd:
+            mZstdContext.reset(ZSTD_createCCtx());
+            return mZstdContext
+                && !ZSTD_isError(ZSTD_CCtx_setParameter(
+                    mZstdContext.get(),
+                    ZSTD_c_compressionLevel,
+                    level < 0 ? ZSTD_CLEVEL_DEFAULT : level
+                ));
+#endif
+#if defined(NBT_USE_LZ4)
+        case NbtCompressionType::LZ4: {
+            LZ4F_cctx* context = nullptr;
+            if (LZ4F_isError(LZ4F_createCompressionContext(&context, LZ4F_VERSION))) { return false; }
+            mLz4Context.reset(context);
+            LZ4F_preferences_t preferences{};
+            preferences.compressionLevel = std::max(level, 0);
+            mBuffer.resize(std::max(mBuffer.size(), LZ4F_compressBound(ZLIB_STREAM_CHUNK, &preferences)));
+            auto size = LZ4F_compressBegin(mLz4Context.get(), mBuffer.data(), mBuffer.size(), &preferences);
+            if (LZ4F_isError(size)) { return false; }
+            mSink(std::string_view(mBuffer.data(), size));
+            return true;
+        }
+#endif
+        default:
+            return false;
+        }
+    }
+
+    void emit(size_t size) {
+        if (size > 0) { mSink(std::string_view(mBuffer.data(), size)); }
+    }
+
+    bool emitZlib() {
+        auto& stream = mZlib->get();
+        auto  isFull = stream.avail_out == 0;
+        emit(mBuffer.size() - stream.avail_out);
+        stream.next_out  = reinterpret_cast<Bytef*>(mBuffer.data());
+        stream.avail_out = static_cast<uInt>(mBuffer.size());
+        return isFull;
+    }
+
+#if defined(NBT_USE_LZ4)
+    void emitLz4(size_t size) {
+        if (LZ4F_isError(size)) {
+            mFailed = true;
+        } else {
+            emit(size);
+        }
+    }
+#endif
+};
+
+CompressStream::CompressStream(NbtCompressionType type, int level, ByteSink sink)
+: mState(std::make_unique<State>(type, level, std::move(sink))) {}
+
+CompressStream::~CompressStream() = default;
 
-        ret = inflate(&zstr, Z_NO_FLUSH);
+bool CompressStream::isReady() const noexcept { return mState->isReady(); }
 
-        if (ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) { break; }
+void CompressStream::write(std::string_view data) { mState->write(data); }
 
-        size_t have = ZLIB_STREAM_CHUNK - zstr.avail_out;
-        output.append(reinterpret_cast<char*>(out_buffer), have);
-    } while (zstr.avail_out == 0);
+bool CompressStream::finish() { return mState->finish(); }
 
-    inflateEnd(&zstr);
-    return (ret == Z_STREAM_END) ? output : std::string(input);
+ByteSource makeDecompressSource(std::string_view input) {
+    return makeDecompressSource(std::make_shared<Decompressor>(input, nullptr, 0, false));
 }
+
+ByteSource makeDecompressSource(ByteSource source, size_t bufferSize) {
+    return makeDecompressSource(
+        std::make_shared<Decompressor>(std::string_view{}, std::move(source), bufferSize, false)
+    );
+}
+
 } // namespace nbt::detail
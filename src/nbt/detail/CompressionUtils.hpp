@@ -6,12 +6,47 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #pragma once
+#include <functional>
+#include <memory>
+#include <nbt/types/NbtCompressionType.hpp>
 #include <string>
 
 namespace nbt::detail {
 
-std::string compress(std::string_view input, int level, int windowBits);
+using ByteSource = std::function<size_t(char* buffer, size_t size)>;
+using ByteSink   = std::function<void(std::string_view data)>;
+
+class CompressStream {
+public:
+    class State;
+
+protected:
+    std::unique_ptr<State> mState;
+
+public:
+    CompressStream(NbtCompressionType type, int level, ByteSink sink);
+    ~CompressStream();
+
+    CompressStream(CompressStream const&)            = delete;
+    CompressStream& operator=(CompressStream const&) = delete;
+
+    [[nodiscard]] bool isReady() const noexcept;
+
+    void write(std::string_view data);
+
+    bool finish();
+};
+
+NbtCompressionType detectCompressionType(std::string_view input) noexcept;
+
+bool isCompressionSupported(NbtCompressionType type) noexcept;
+
+std::string compress(std::string_view input, NbtCompressionType type, int level);
 
 std::string decompress(std::string_view input);
 
+ByteSource makeDecompressSource(std::string_view input);
+
+ByteSource makeDecompressSource(ByteSource source, size_t bufferSize);
+
 } // namespace nbt::detail
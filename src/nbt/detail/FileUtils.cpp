@@ -6,73 +6,74 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/detail/FileUtils.hpp"
+#include "nbt/io/MappedFile.hpp"
+#include <atomic>
+#include <cstdio>
 #include <fstream>
+#include <string>
 
 #ifdef _WIN32
 #include <windows.h>
 #else
+#include <cerrno>
 #include <fcntl.h>
-#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
 
 namespace nbt::detail {
 
-void readFileMMap(std::filesystem::path const& path, std::string& content) {
+namespace {
+
+std::atomic<uint64_t> tempCounter{0};
+
+uint64_t processId() noexcept {
+#ifdef _WIN32
+    return GetCurrentProcessId();
+#else
+    return static_cast<uint64_t>(::getpid());
+#endif
+}
+
+std::filesystem::path makeTempPath(std::filesystem::path const& path) {
+    auto result = path;
+    result += ".tmp." + std::to_string(processId()) + "." + std::to_string(tempCounter.fetch_add(1));
+    return result;
+}
+
+intptr_t openForWrite(std::filesystem::path const& path, bool exclusive) noexcept {
 #ifdef _WIN32
-    HANDLE hFile = CreateFileA(
-        path.string().c_str(),
-        GENERIC_READ,
-        FILE_SHARE_READ,
+    HANDLE hFile = CreateFileW(
+        path.wstring().c_str(),
+        GENERIC_WRITE,
+        0,
         NULL,
-        OPEN_EXISTING,
-        FILE_ATTRIBUTE_NORMAL,
+        exclusive ? CREATE_NEW : CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
         NULL
     );
-    if (hFile == INVALID_HANDLE_VALUE) { return; }
-    DWORD size = GetFileSize(hFile, NULL);
-    if (size == INVALID_FILE_SIZE) {
-        CloseHandle(hFile);
-        return;
-    }
-    HANDLE hMapping = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
-    if (!hMapping) {
-        CloseHandle(hFile);
-        return;
-    }
-    LPVOID mapped = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
-    if (!mapped) {
-        CloseHandle(hMapping);
-        CloseHandle(hFile);
-        return;
-    }
-    content.assign(static_cast<char*>(mapped), size);
-    UnmapViewOfFile(mapped);
-    CloseHandle(hMapping);
-    CloseHandle(hFile);
+    return hFile == INVALID_HANDLE_VALUE ? -1 : reinterpret_cast<intptr_t>(hFile);
 #else
-    int fd = ::open(path.string().c_str(), O_RDONLY);
+    auto flags = O_WRONLY | O_CREAT | O_CLOEXEC | (exclusive ? O_EXCL : O_TRUNC);
+    return ::open(path.c_str(), flags, 0666);
+#endif
+}
+
+#ifndef _WIN32
+void syncDirectory(std::filesystem::path const& path) noexcept {
+    auto parent = path.parent_path();
+    int  fd     = ::open(parent.empty() ? "." : parent.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
     if (fd == -1) { return; }
-    struct stat sb;
-    if (::fstat(fd, &sb) == -1) {
-        ::close(fd);
-        return;
-    }
-    void* mapped = ::mmap(nullptr, static_cast<size_t>(sb.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
-    if (mapped == MAP_FAILED) {
-        ::close(fd);
-        return;
-    }
-    content.assign(static_cast<char*>(mapped), static_cast<size_t>(sb.st_size));
-    ::munmap(mapped, static_cast<size_t>(sb.st_size));
+    ::fsync(fd);
     ::close(fd);
-#endif
 }
+#endif
+
+} // namespace
 
 void readFile(std::filesystem::path const& path, std::string& content, bool fileMemoryMap) {
     if (fileMemoryMap) {
-        readFileMMap(path, content);
+        if (auto file = io::MappedFile::open(path)) { content.assign(file->getContent()); }
     } else {
         std::ifstream fRead(path, std::ios::ate | std::ios::binary);
         if (fRead.is_open()) {
@@ -84,4 +85,91 @@ void readFile(std::filesystem::path const& path, std::string& content, bool file
     }
 }
 
+FileWriter::FileWriter(std::filesystem::path const& path, NbtSaveMode mode) : mPath(path), mMode(mode) {
+    if (mMode == NbtSaveMode::Direct) {
+        mHandle = openForWrite(mPath, false);
+        return;
+    }
+    for (int attempt = 0; attempt < 16 && mHandle == -1; attempt++) {
+        mTempPath = makeTempPath(mPath);
+        mHandle   = openForWrite(mTempPath, true);
+#ifndef _WIN32
+        if (mHandle == -1 && errno != EEXIST) { break; }
+#endif
+    }
+    if (mHandle == -1) {
+        mTempPath.clear();
+        return;
+    }
+#ifndef _WIN32
+    struct stat sb;
+    if (::stat(mPath.c_str(), &sb) == 0) { ::fchmod(static_cast<int>(mHandle), sb.st_mode & 07777); }
+#endif
+}
+
+FileWriter::~FileWriter() {
+    close();
+    if (!mTempPath.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(mTempPath, ec);
+    }
+}
+
+bool FileWriter::isOpen() const noexcept { return mHandle != -1; }
+
+void FileWriter::write(std::string_view data) noexcept {
+    if (mFailed || mHandle == -1) { return; }
+    while (!data.empty()) {
+#ifdef _WIN32
+        DWORD written = 0;
+        auto  size    = static_cast<DWORD>(data.size() > 0x40000000 ? 0x40000000 : data.size());
+        if (!WriteFile(reinterpret_cast<HANDLE>(mHandle), data.data(), size, &written, NULL)) {
+            mFailed = true;
+            return;
+        }
+#else
+        auto written = ::write(static_cast<int>(mHandle), data.data(), data.size());
+        if (written == -1) {
+            if (errno == EINTR) { continue; }
+            mFailed = true;
+            return;
+        }
+#endif
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+}
+
+bool FileWriter::close() noexcept {
+    if (mHandle == -1) { return true; }
+#ifdef _WIN32
+    auto closed = CloseHandle(reinterpret_cast<HANDLE>(mHandle)) != 0;
+#else
+    auto closed = ::close(static_cast<int>(mHandle)) == 0;
+#endif
+    mHandle = -1;
+    return closed;
+}
+
+bool FileWriter::commit() noexcept {
+    if (mHandle == -1) { return false; }
+    if (!mFailed && mMode == NbtSaveMode::Durable) {
+#ifdef _WIN32
+        mFailed = !FlushFileBuffers(reinterpret_cast<HANDLE>(mHandle));
+#else
+        mFailed = ::fsync(static_cast<int>(mHandle)) != 0;
+#endif
+    }
+    if (!close() || mFailed) { return false; }
+    if (mMode == NbtSaveMode::Direct) { return true; }
+#ifdef _WIN32
+    DWORD flags = MOVEFILE_REPLACE_EXISTING | (mMode == NbtSaveMode::Durable ? MOVEFILE_WRITE_THROUGH : 0);
+    if (!MoveFileExW(mTempPath.wstring().c_str(), mPath.wstring().c_str(), flags)) { return false; }
+#else
+    if (::rename(mTempPath.c_str(), mPath.c_str()) != 0) { return false; }
+    if (mMode == NbtSaveMode::Durable) { syncDirectory(mPath); }
+#endif
+    mTempPath.clear();
+    return true;
+}
+
 } // namespace nbt::detail
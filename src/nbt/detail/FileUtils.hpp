@@ -5,10 +5,51 @@
 //
 // SPDX-License-Identifier: MPL-2.0
 
+#pragma once
+#include "nbt/io/MappedFile.hpp"
+#include <cstdint>
 #include <filesystem>
+#include <nbt/types/NbtSaveMode.hpp>
+#include <string>
 
 namespace nbt::detail {
 
 void readFile(std::filesystem::path const& path, std::string& content, bool fileMemoryMap);
 
+class FileWriter {
+protected:
+    std::filesystem::path mPath;
+    std::filesystem::path mTempPath;
+    NbtSaveMode           mMode;
+    intptr_t              mHandle{-1};
+    bool                  mFailed{false};
+
+public:
+    FileWriter(std::filesystem::path const& path, NbtSaveMode mode);
+    ~FileWriter();
+
+    FileWriter(FileWriter const&)            = delete;
+    FileWriter& operator=(FileWriter const&) = delete;
+
+    [[nodiscard]] bool isOpen() const noexcept;
+
+    void write(std::string_view data) noexcept;
+
+    bool commit() noexcept;
+
+protected:
+    bool close() noexcept;
+};
+
+template <typename Function>
+decltype(auto) visitFileContent(std::filesystem::path const& path, bool fileMemoryMap, Function&& function) {
+    if (fileMemoryMap) {
+        auto file = io::MappedFile::open(path);
+        return function(file ? file->getContent() : std::string_view{});
+    }
+    std::string content;
+    readFile(path, content, false);
+    return function(std::string_view(content));
+}
+
 } // namespace nbt::detail
@@ -197,11 +197,11 @@ std::string TypedToSnbt(ListTag const& self, uint8_t indent, SnbtFormat format,
                   && (static_cast<bool>(format & SnbtFormat::ForceLineFeedIgnoreIndent) || (indent > 0));
 
     if (isNewLine && self.size() > 0) { res += '\n'; }
-    for (auto& tag : self) {
+    auto append = [&](Tag const& tag) {
         i--;
         if (isNewLine) { res += indentSpace; }
-        auto key = tag->toSnbt(format, indent);
-        if (dumpJson) { key = tag->toJson(); }
+        auto key = tag.toSnbt(format, indent);
+        if (dumpJson) { key = tag.toJson(); }
 
         if (isNewLine) { string_utils::replaceAll(key, "\n", "\n" + indentSpace); }
         res += key;
@@ -211,6 +211,36 @@ std::string TypedToSnbt(ListTag const& self, uint8_t indent, SnbtFormat format,
             if (!isMinimized && !isNewLine) { res += ' '; }
         }
         if (isNewLine) { res += '\n'; }
+    };
+    auto appendPacked = [&]<typename T, typename V>() {
+        for (auto value : self.values<V>()) { append(T(value)); }
+    };
+
+    if (!self.isPacked()) {
+        for (auto& tag : self) { append(*tag); }
+    } else {
+        switch (self.getElementType()) {
+        case Tag::Type::Byte:
+            appendPacked.template operator()<ByteTag, uint8_t>();
+            break;
+        case Tag::Type::Short:
+            appendPacked.template operator()<ShortTag, int16_t>();
+            break;
+        case Tag::Type::Int:
+            appendPacked.template operator()<IntTag, int>();
+            break;
+        case Tag::Type::Long:
+            appendPacked.template operator()<LongTag, int64_t>();
+            break;
+        case Tag::Type::Float:
+            appendPacked.template operator()<FloatTag, float>();
+            break;
+        case Tag::Type::Double:
+            appendPacked.template operator()<DoubleTag, double>();
+            break;
+        default:
+            break;
+        }
     }
 
     res += rbracket;
@@ -0,0 +1,196 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+#include "nbt/io/BytesDataInput.hpp"
+#include "nbt/io/BytesDataOutput.hpp"
+#include "nbt/types/ByteArrayTag.hpp"
+#include "nbt/types/ByteTag.hpp"
+#include "nbt/types/CompoundTag.hpp"
+#include "nbt/types/CompoundTagVariant.hpp"
+#include "nbt/types/DoubleTag.hpp"
+#include "nbt/types/EndTag.hpp"
+#include "nbt/types/FloatTag.hpp"
+#include "nbt/types/IntArrayTag.hpp"
+#include "nbt/types/IntTag.hpp"
+#include "nbt/types/ListTag.hpp"
+#include "nbt/types/LongArrayTag.hpp"
+#include "nbt/types/LongTag.hpp"
+#include "nbt/types/ShortTag.hpp"
+#include "nbt/types/StringTag.hpp"
+
+namespace nbt::detail {
+
+template <typename T>
+concept ScalarTag = std::is_same_v<T, ByteTag> || std::is_same_v<T, ShortTag> || std::is_same_v<T, IntTag>
+                 || std::is_same_v<T, LongTag> || std::is_same_v<T, FloatTag> || std::is_same_v<T, DoubleTag>;
+
+template <NbtFileFormat Format, bool Checked = true>
+struct Codec {
+    static constexpr bool IsNetwork = Format == NbtFileFormat::BedrockNetwork;
+    static constexpr auto Order     = Format == NbtFileFormat::BigEndian ? std::endian::big : std::endian::little;
+
+    using Input  = std::conditional_t<IsNetwork, bstream::ReadOnlyBinaryStream, io::BytesDataInput>;
+    using Output = std::conditional_t<IsNetwork, bstream::BinaryStream, io::BytesDataOutput>;
+
+    template <typename T>
+    static T readScalar(Input& stream) noexcept {
+        if constexpr (!IsNetwork) {
+            return stream.template getNumber<Order, T, Checked>();
+        } else if constexpr (std::is_same_v<T, uint8_t>) {
+            return stream.getUnsignedChar();
+        } else if constexpr (std::is_same_v<T, int16_t>) {
+            return stream.getSignedShort();
+        } else if constexpr (std::is_same_v<T, int>) {
+            return stream.getVarInt();
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            return stream.getVarInt64();
+        } else if constexpr (std::is_same_v<T, float>) {
+            return stream.getFloat();
+        } else {
+            return stream.getDouble();
+        }
+    }
+
+    template <typename T>
+    static void writeScalar(Output& stream, T value) {
+        if constexpr (!IsNetwork) {
+            stream.template writeNumber<Order>(value);
+        } else if constexpr (std::is_same_v<T, uint8_t>) {
+            stream.writeUnsignedChar(value);
+        } else if constexpr (std::is_same_v<T, int16_t>) {
+            stream.writeSignedShort(value);
+        } else if constexpr (std::is_same_v<T, int>) {
+            stream.writeVarInt(value);
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            stream.writeVarInt64(value);
+        } else if constexpr (std::is_same_v<T, float>) {
+            stream.writeFloat(value);
+        } else {
+            stream.writeDouble(value);
+        }
+    }
+
+    static std::string_view readString(Input& stream) noexcept {
+        if constexpr (IsNetwork) {
+            return stream.getStringView();
+        } else {
+            return stream.template getStringView<Order, Checked>();
+        }
+    }
+
+    static void writeString(Output& stream, std::string_view value) {
+        if constexpr (IsNetwork) {
+            stream.writeString(value);
+        } else {
+            stream.template writeString<Order>(value);
+        }
+    }
+
+    static void write(Output& stream, CompoundTagVariant const& tag) {
+        std::visit(
+            [&]<typename T>(T const& value) {
+                if constexpr (ScalarTag<T>) {
+                    writeScalar(stream, value.mStorage);
+                } else if constexpr (std::is_same_v<T, StringTag>) {
+                    writeString(stream, value.mStorage);
+                } else {
+                    value.T::write(stream);
+                }
+            },
+            tag.mStorage
+        );
+    }
+
+    static void load(Input& stream, CompoundTagVariant& tag) {
+        std::visit(
+            [&]<typename T>(T& value) {
+                if constexpr (ScalarTag<T>) {
+                    value.mStorage = readScalar<decltype(value.mStorage)>(stream);
+                } else if constexpr (std::is_same_v<T, StringTag>) {
+                    value.mStorage = readString(stream);
+                } else {
+                    value.T::load(stream);
+                }
+            },
+            tag.mStorage
+        );
+    }
+
+    static void writeEntries(Output& stream, TagMap const& entries) {
+        for (auto const& [key, value] : entries) {
+            auto type = value.getType();
+            if (type == Tag::Type::End) { continue; }
+            writeScalar(stream, static_cast<uint8_t>(type));
+            writeString(stream, key);
+            write(stream, value);
+        }
+        writeScalar(stream, static_cast<uint8_t>(Tag::Type::End));
+    }
+
+    static void loadEntries(Input& stream, TagMap& entries) {
+        while (true) {
+            auto type = static_cast<Tag::Type>(readScalar<uint8_t>(stream));
+            if (type == Tag::Type::End) { return; }
+            auto key = readString(stream);
+            if (type >= Tag::Type::NumTagTypes) { continue; }
+            if (auto [iter, inserted] = entries.try_emplace(key); inserted) {
+                iter->second.emplace(type);
+                load(stream, iter->second);
+            } else {
+                CompoundTagVariant skipped;
+                skipped.emplace(type);
+                load(stream, skipped);
+            }
+        }
+    }
+
+    static void writeElements(Output& stream, ListTag::TagList const& elements) {
+        for (auto const& element : elements) { write(stream, element); }
+    }
+
+    static void loadElements(Input& stream, ListTag::TagList& elements, Tag::Type type, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            auto& element = elements.emplace_back();
+            element.emplace(type);
+            load(stream, element);
+        }
+    }
+};
+
+template <typename Function>
+decltype(auto) visitCodec(io::BytesDataOutput const& stream, Function&& function) {
+    if (stream.isLittleEndian()) { return function(Codec<NbtFileFormat::LittleEndian>{}); }
+    return function(Codec<NbtFileFormat::BigEndian>{});
+}
+
+template <typename Function>
+decltype(auto) visitCodec(io::BytesDataInput const& stream, Function&& function) {
+    if (stream.isValidated()) {
+        if (stream.isLittleEndian()) { return function(Codec<NbtFileFormat::LittleEndian, false>{}); }
+        return function(Codec<NbtFileFormat::BigEndian, false>{});
+    }
+    if (stream.isLittleEndian()) { return function(Codec<NbtFileFormat::LittleEndian>{}); }
+    return function(Codec<NbtFileFormat::BigEndian>{});
+}
+
+template <typename Function>
+decltype(auto) visitCodec(bstream::ReadOnlyBinaryStream const&, Function&& function) {
+    return function(Codec<NbtFileFormat::BedrockNetwork>{});
+}
+
+template <typename Stream>
+void writePayload(Stream& stream, CompoundTagVariant const& tag) {
+    visitCodec(stream, [&]<typename C>(C) { C::write(stream, tag); });
+}
+
+template <typename Stream>
+void loadPayload(Stream& stream, CompoundTagVariant& tag) {
+    visitCodec(stream, [&]<typename C>(C) { C::load(stream, tag); });
+}
+
+} // namespace nbt::detail
@@ -9,91 +9,144 @@
 
 namespace nbt::detail {
 
+bool hasRemaining(io::BytesDataInput const& stream, size_t count, size_t elementSize, size_t streamSize) noexcept {
+    auto position = stream.getPosition();
+    return position <= streamSize && count <= (streamSize - position) / elementSize;
+}
+
 bool validateListTag(io::BytesDataInput& stream, size_t streamSize) {
-    if (stream.getPosition() + sizeof(uint8_t) > streamSize) { return false; }
+    if (!hasRemaining(stream, 1, sizeof(uint8_t), streamSize)) { return false; }
     auto type = static_cast<Tag::Type>(stream.getByte());
-    if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
+    if (!hasRemaining(stream, 1, sizeof(int), streamSize)) { return false; }
     auto size = static_cast<size_t>(stream.getInt());
     switch (type) {
     case Tag::Type::End: {
         return true;
     }
     case Tag::Type::Byte: {
-        if (stream.getPosition() + (sizeof(uint8_t) * size) > streamSize) { return false; }
+        if (!hasRemaining(stream, size, sizeof(uint8_t), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(uint8_t) * size);
         break;
     }
     case Tag::Type::Short: {
-        if (stream.getPosition() + (sizeof(short) * size) > streamSize) { return false; }
+        if (!hasRemaining(stream, size, sizeof(short), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(short) * size);
         break;
     }
     case Tag::Type::Int: {
-        if (stream.getPosition() + (sizeof(int) * size) > streamSize) { return false; }
+        if (!hasRemaining(stream, size, sizeof(int), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(int) * size);
         break;
     }
     case Tag::Type::Long: {
-        if (stream.getPosition() + (sizeof(int64_t) * size) > streamSize) { return false; }
+        if (!hasRemaining(stream, size, sizeof(int64_t), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(int64_t) * size);
         break;
     }
     case Tag::Type::Float: {
-        if (stream.getPosition() + (sizeof(float) * size) > streamSize) { return false; }
+        if (!hasRemaining(stream, size, sizeof(float), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(float) * size);
         break;
     }
     case Tag::Type::Double: {
-        if (stream.getPosition() + (sizeof(double) * size) > streamSize) { return false; }
+        if (!hasRemaining(stream, size, sizeof(double), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(double) * size);
         break;
     }
-    case Tag::Type::ByteArray: {
+    default: {
+        if (type >= Tag::Type::NumTagTypes) { return false; }
         for (size_t i = 0; i < size; i++) {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            auto len = static_cast<size_t>(stream.getInt());
-            if (stream.getPosition() + (sizeof(uint8_t) * len) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(uint8_t) * len));
+            if (!validateTag(stream, type, streamSize)) { return false; }
         }
         break;
     }
+    }
+    return true;
+}
+
+bool validateCompoundTag(io::BytesDataInput& stream, size_t streamSize) {
+    while (true) {
+        if (!hasRemaining(stream, 1, sizeof(uint8_t), streamSize)) { return false; }
+        auto type = static_cast<Tag::Type>(stream.getByte());
+        if (type == Tag::Type::End) { return true; }
+        if (!hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
+        auto strLen = static_cast<size_t>(stream.getShort());
+        if (!hasRemaining(stream, strLen, 1, streamSize)) { return false; }
+        stream.ignoreBytes(strLen);
+        if (!validateTag(stream, type, streamSize)) { return false; }
+    }
+    return true;
+}
+
+bool validateTag(io::BytesDataInput& stream, Tag::Type type, size_t streamSize) {
+    switch (type) {
+    case Tag::Type::End: {
+        return true;
+    }
+    case Tag::Type::Byte: {
+        if (!hasRemaining(stream, 1, sizeof(uint8_t), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(uint8_t));
+        break;
+    }
+    case Tag::Type::Short: {
+        if (!hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(short));
+        break;
+    }
+    case Tag::Type::Int: {
+        if (!hasRemaining(stream, 1, sizeof(int), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(int));
+        break;
+    }
+    case Tag::Type::Long: {
+        if (!hasRemaining(stream, 1, sizeof(int64_t), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(int64_t));
+        break;
+    }
+    case Tag::Type::Float: {
+        if (!hasRemaining(stream, 1, sizeof(float), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(float));
+        break;
+    }
+    case Tag::Type::Double: {
+        if (!hasRemaining(stream, 1, sizeof(double), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(double));
+        break;
+    }
+    case Tag::Type::ByteArray: {
+        if (!hasRemaining(stream, 1, sizeof(int), streamSize)) { return false; }
+        auto size = static_cast<size_t>(stream.getInt());
+        if (!hasRemaining(stream, size, sizeof(uint8_t), streamSize)) { return false; }
+        stream.ignoreBytes((sizeof(uint8_t) * size));
+        break;
+    }
     case Tag::Type::String: {
-        for (size_t i = 0; i < size; i++) {
-            if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
-            auto strSize = static_cast<size_t>(stream.getShort());
-            if (stream.getPosition() + strSize > streamSize) { return false; }
-            stream.ignoreBytes(strSize);
-        }
+        if (!hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
+        auto strSize = static_cast<size_t>(stream.getShort());
+        if (!hasRemaining(stream, strSize, 1, streamSize)) { return false; }
+        stream.ignoreBytes(strSize);
         break;
     }
     case Tag::Type::List: {
-        for (size_t i = 0; i < size; i++) {
-            if (!validateListTag(stream, streamSize)) { return false; }
-        }
+        if (!validateListTag(stream, streamSize)) { return false; }
         break;
     }
     case Tag::Type::Compound: {
-        for (size_t i = 0; i < size; i++) {
-            if (!validateCompoundTag(stream, streamSize)) { return false; }
-        }
+        if (!validateCompoundTag(stream, streamSize)) { return false; }
         break;
     }
     case Tag::Type::IntArray: {
-        for (size_t i = 0; i < size; i++) {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            auto len = static_cast<size_t>(stream.getInt());
-            if (stream.getPosition() + (sizeof(int) * len) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(int) * len));
-        }
+        if (!hasRemaining(stream, 1, sizeof(int), streamSize)) { return false; }
+        auto size = static_cast<size_t>(stream.getInt());
+        if (!hasRemaining(stream, size, sizeof(int), streamSize)) { return false; }
+        stream.ignoreBytes((sizeof(int) * size));
         break;
     }
     case Tag::Type::LongArray: {
-        for (size_t i = 0; i < size; i++) {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            auto len = static_cast<size_t>(stream.getInt());
-            if (stream.getPosition() + (sizeof(int64_t) * len) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(int64_t) * len));
-        }
+        if (!hasRemaining(stream, 1, sizeof(int), streamSize)) { return false; }
+        auto size = static_cast<size_t>(stream.getInt());
+        if (!hasRemaining(stream, size, sizeof(int64_t), streamSize)) { return false; }
+        stream.ignoreBytes((sizeof(int64_t) * size));
         break;
     }
     default:
@@ -102,175 +155,150 @@ bool validateListTag(io::BytesDataInput& stream, size_t streamSize) {
     return true;
 }
 
-bool validateCompoundTag(io::BytesDataInput& stream, size_t streamSize) {
+bool hasRemaining(
+    bstream::ReadOnlyBinaryStream const& stream,
+    size_t                               count,
+    size_t                               elementSize,
+    size_t                               streamSize
+) noexcept {
+    auto position = stream.getPosition();
+    return position <= streamSize && count <= (streamSize - position) / elementSize;
+}
+
+namespace {
+
+bool getLength(bstream::ReadOnlyBinaryStream& stream, size_t& length) {
+    auto value = stream.getVarInt();
+    if (stream.isOverflowed() || value < 0) { return false; }
+    length = static_cast<size_t>(value);
+    return true;
+}
+
+} // namespace
+
+bool validateListTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize) {
+    if (!hasRemaining(stream, 1, sizeof(uint8_t), streamSize)) { return false; }
+    auto type = static_cast<Tag::Type>(stream.getByte());
+    auto size = stream.getVarInt();
+    if (stream.isOverflowed()) { return false; }
+    if (type == Tag::Type::End) { return true; }
+    if (size < 0) { return false; }
+    auto count = static_cast<size_t>(size);
+    switch (type) {
+    case Tag::Type::Byte: {
+        if (!hasRemaining(stream, count, sizeof(uint8_t), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(uint8_t) * count);
+        break;
+    }
+    case Tag::Type::Short: {
+        if (!hasRemaining(stream, count, sizeof(short), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(short) * count);
+        break;
+    }
+    case Tag::Type::Float: {
+        if (!hasRemaining(stream, count, sizeof(float), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(float) * count);
+        break;
+    }
+    case Tag::Type::Double: {
+        if (!hasRemaining(stream, count, sizeof(double), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(double) * count);
+        break;
+    }
+    default: {
+        if (type >= Tag::Type::NumTagTypes || !hasRemaining(stream, count, 1, streamSize)) { return false; }
+        for (size_t i = 0; i < count; i++) {
+            if (!validateTag(stream, type, streamSize)) { return false; }
+        }
+        break;
+    }
+    }
+    return true;
+}
+
+bool validateCompoundTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize) {
     while (true) {
-        if (stream.getPosition() + sizeof(uint8_t) > streamSize) { return false; }
+        if (!hasRemaining(stream, 1, sizeof(uint8_t), streamSize)) { return false; }
         auto type = static_cast<Tag::Type>(stream.getByte());
         if (type == Tag::Type::End) { return true; }
-        if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
-        auto strLen = static_cast<size_t>(stream.getShort());
-        if (stream.getPosition() + strLen > streamSize) { return false; }
+        auto strLen = stream.getUnsignedVarInt();
+        if (stream.isOverflowed() || !hasRemaining(stream, strLen, 1, streamSize)) { return false; }
         stream.ignoreBytes(strLen);
-        switch (type) {
-        case Tag::Type::Byte: {
-            if (stream.getPosition() + sizeof(uint8_t) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(uint8_t));
-            break;
-        }
-        case Tag::Type::Short: {
-            if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(short));
-            break;
-        }
-        case Tag::Type::Int: {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(int));
-            break;
-        }
-        case Tag::Type::Long: {
-            if (stream.getPosition() + sizeof(int64_t) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(int64_t));
-            break;
-        }
-        case Tag::Type::Float: {
-            if (stream.getPosition() + sizeof(float) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(float));
-            break;
-        }
-        case Tag::Type::Double: {
-            if (stream.getPosition() + sizeof(double) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(double));
-            break;
-        }
-        case Tag::Type::ByteArray: {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            auto size = static_cast<size_t>(stream.getInt());
-            if (stream.getPosition() + (sizeof(uint8_t) * size) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(uint8_t) * size));
-            break;
-        }
-        case Tag::Type::String: {
-            if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
-            auto strSize = static_cast<size_t>(stream.getShort());
-            if (stream.getPosition() + strSize > streamSize) { return false; }
-            stream.ignoreBytes(strSize);
-            break;
-        }
-        case Tag::Type::List: {
-            if (!validateListTag(stream, streamSize)) { return false; }
-            break;
-        }
-        case Tag::Type::Compound: {
-            if (!validateCompoundTag(stream, streamSize)) { return false; }
-            break;
-        }
-        case Tag::Type::IntArray: {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            auto size = static_cast<size_t>(stream.getInt());
-            if (stream.getPosition() + (sizeof(int) * size) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(int) * size));
-            break;
-        }
-        case Tag::Type::LongArray: {
-            if (stream.getPosition() + sizeof(int) > streamSize) { return false; }
-            auto size = static_cast<size_t>(stream.getInt());
-            if (stream.getPosition() + (sizeof(int64_t) * size) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(int64_t) * size));
-            break;
-        }
-        default:
-            return false;
-        }
+        if (!validateTag(stream, type, streamSize)) { return false; }
     }
     return true;
 }
 
-bool validateListTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize) {
-    if (stream.getPosition() + sizeof(uint8_t) > streamSize) { return false; }
-    auto type = static_cast<Tag::Type>(stream.getByte());
-    auto size = static_cast<size_t>(stream.getVarInt());
-    if (stream.isOverflowed()) { return false; }
+bool validateTag(bstream::ReadOnlyBinaryStream& stream, Tag::Type type, size_t streamSize) {
     switch (type) {
     case Tag::Type::End: {
         return true;
     }
     case Tag::Type::Byte: {
-        if (stream.getPosition() + (sizeof(uint8_t) * size) > streamSize) { return false; }
-        stream.ignoreBytes(sizeof(uint8_t) * size);
+        if (!hasRemaining(stream, 1, sizeof(uint8_t), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(uint8_t));
         break;
     }
     case Tag::Type::Short: {
-        if (stream.getPosition() + (sizeof(short) * size) > streamSize) { return false; }
-        stream.ignoreBytes(sizeof(short) * size);
+        if (!hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(short));
         break;
     }
     case Tag::Type::Int: {
-        (void)stream.getVarInt();
+        (void)stream.getUnsignedVarInt();
         if (stream.isOverflowed()) { return false; }
         break;
     }
     case Tag::Type::Long: {
-        (void)stream.getVarInt64();
+        (void)stream.getUnsignedVarInt64();
         if (stream.isOverflowed()) { return false; }
         break;
     }
     case Tag::Type::Float: {
-        if (stream.getPosition() + (sizeof(float) * size) > streamSize) { return false; }
-        stream.ignoreBytes(sizeof(float) * size);
+        if (!hasRemaining(stream, 1, sizeof(float), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(float));
         break;
     }
     case Tag::Type::Double: {
-        if (stream.getPosition() + (sizeof(double) * size) > streamSize) { return false; }
-        stream.ignoreBytes(sizeof(double) * size);
+        if (!hasRemaining(stream, 1, sizeof(double), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(double));
         break;
     }
     case Tag::Type::ByteArray: {
-        for (size_t i = 0; i < size; i++) {
-            auto len = static_cast<size_t>(stream.getVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + (sizeof(uint8_t) * len) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(uint8_t) * len));
-        }
+        size_t size = 0;
+        if (!getLength(stream, size) || !hasRemaining(stream, size, sizeof(uint8_t), streamSize)) { return false; }
+        stream.ignoreBytes(sizeof(uint8_t) * size);
         break;
     }
     case Tag::Type::String: {
-        for (size_t i = 0; i < size; i++) {
-            auto strSize = static_cast<size_t>(stream.getUnsignedVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + strSize > streamSize) { return false; }
-            stream.ignoreBytes(strSize);
-        }
+        auto strSize = stream.getUnsignedVarInt();
+        if (stream.isOverflowed() || !hasRemaining(stream, strSize, 1, streamSize)) { return false; }
+        stream.ignoreBytes(strSize);
         break;
     }
     case Tag::Type::List: {
-        for (size_t i = 0; i < size; i++) {
-            if (!validateListTag(stream, streamSize)) { return false; }
-        }
+        if (!validateListTag(stream, streamSize)) { return false; }
         break;
     }
     case Tag::Type::Compound: {
-        for (size_t i = 0; i < size; i++) {
-            if (!validateCompoundTag(stream, streamSize)) { return false; }
-        }
+        if (!validateCompoundTag(stream, streamSize)) { return false; }
         break;
     }
     case Tag::Type::IntArray: {
+        size_t size = 0;
+        if (!getLength(stream, size) || !hasRemaining(stream, size, 1, streamSize)) { return false; }
         for (size_t i = 0; i < size; i++) {
-            auto len = static_cast<size_t>(stream.getVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + (sizeof(int) * len) > streamSize) { return false; }
-            for (size_t j = 0; j < len; j++) {
-                (void)stream.getVarInt();
-                if (stream.isOverflowed()) { return false; }
-            }
+            (void)stream.getVarInt();
+            if (stream.isOverflowed()) { return false; }
         }
         break;
     }
     case Tag::Type::LongArray: {
+        size_t size = 0;
+        if (!getLength(stream, size) || !hasRemaining(stream, size, 1, streamSize)) { return false; }
         for (size_t i = 0; i < size; i++) {
-            auto len = static_cast<size_t>(stream.getVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + (sizeof(int64_t) * len) > streamSize) { return false; }
-            for (size_t j = 0; j < len; j++) {
-                (void)stream.getVarInt64();
-                if (stream.isOverflowed()) { return false; }
-            }
+            (void)stream.getVarInt64();
+            if (stream.isOverflowed()) { return false; }
         }
         break;
     }
@@ -280,88 +308,4 @@ bool validateListTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize) {
     return true;
 }
 
-bool validateCompoundTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize) {
-    while (true) {
-        if (stream.getPosition() + sizeof(uint8_t) > streamSize) { return false; }
-        auto type = static_cast<Tag::Type>(stream.getByte());
-        if (type == Tag::Type::End) { return true; }
-        auto strLen = stream.getUnsignedVarInt();
-        if (stream.isOverflowed() || stream.getPosition() + strLen > streamSize) { return false; }
-        stream.ignoreBytes(strLen);
-        switch (type) {
-        case Tag::Type::Byte: {
-            if (stream.getPosition() + sizeof(uint8_t) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(uint8_t));
-            break;
-        }
-        case Tag::Type::Short: {
-            if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(short));
-            break;
-        }
-        case Tag::Type::Int: {
-            (void)stream.getUnsignedVarInt();
-            if (stream.isOverflowed()) { return false; }
-            break;
-        }
-        case Tag::Type::Long: {
-            (void)stream.getUnsignedVarInt64();
-            if (stream.isOverflowed()) { return false; }
-            break;
-        }
-        case Tag::Type::Float: {
-            if (stream.getPosition() + sizeof(float) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(float));
-            break;
-        }
-        case Tag::Type::Double: {
-            if (stream.getPosition() + sizeof(double) > streamSize) { return false; }
-            stream.ignoreBytes(sizeof(double));
-            break;
-        }
-        case Tag::Type::ByteArray: {
-            auto size = static_cast<size_t>(stream.getVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + (sizeof(uint8_t) * size) > streamSize) { return false; }
-            stream.ignoreBytes((sizeof(uint8_t) * size));
-            break;
-        }
-        case Tag::Type::String: {
-            auto strSize = static_cast<size_t>(stream.getUnsignedVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + strSize > streamSize) { return false; }
-            stream.ignoreBytes(strSize);
-            break;
-        }
-        case Tag::Type::List: {
-            if (!validateListTag(stream, streamSize)) { return false; }
-            break;
-        }
-        case Tag::Type::Compound: {
-            if (!validateCompoundTag(stream, streamSize)) { return false; }
-            break;
-        }
-        case Tag::Type::IntArray: {
-            auto size = static_cast<size_t>(stream.getVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + (sizeof(int) * size) > streamSize) { return false; }
-            for (size_t i = 0; i < size; i++) {
-                (void)stream.getVarInt();
-                if (stream.isOverflowed()) { return false; }
-            }
-            break;
-        }
-        case Tag::Type::LongArray: {
-            auto size = static_cast<size_t>(stream.getVarInt());
-            if (stream.isOverflowed() || stream.getPosition() + (sizeof(int64_t) * size) > streamSize) { return false; }
-            for (size_t i = 0; i < size; i++) {
-                (void)stream.getVarInt64();
-                if (stream.isOverflowed()) { return false; }
-            }
-            break;
-        }
-        default:
-            return false;
-        }
-    }
-    return true;
-}
-
 } // namespace nbt::detail
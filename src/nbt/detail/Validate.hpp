@@ -10,8 +10,25 @@
 
 namespace nbt::detail {
 
+bool hasRemaining(io::BytesDataInput const& stream, size_t count, size_t elementSize, size_t streamSize) noexcept;
+
+bool hasRemaining(
+    bstream::ReadOnlyBinaryStream const& stream,
+    size_t                               count,
+    size_t                               elementSize,
+    size_t                               streamSize
+) noexcept;
+
 bool validateCompoundTag(io::BytesDataInput& stream, size_t streamSize);
 
 bool validateCompoundTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize);
 
+bool validateListTag(io::BytesDataInput& stream, size_t streamSize);
+
+bool validateListTag(bstream::ReadOnlyBinaryStream& stream, size_t streamSize);
+
+bool validateTag(io::BytesDataInput& stream, Tag::Type type, size_t streamSize);
+
+bool validateTag(bstream::ReadOnlyBinaryStream& stream, Tag::Type type, size_t streamSize);
+
 } // namespace nbt::detail
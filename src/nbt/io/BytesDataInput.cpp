@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/io/BytesDataInput.hpp"
+#include "nbt/detail/ByteSwap.hpp"
 #include <algorithm>
 
 namespace nbt::io {
@@ -14,7 +15,8 @@ BytesDataInput::BytesDataInput(bool isLittleEndian)
 : mReadPointer(0),
   mHasOverflowed(false),
   mBufferView(mOwnedBuffer),
-  mIsLittleEndian(isLittleEndian) {}
+  mIsLittleEndian(isLittleEndian),
+  mIsValidated(false) {}
 
 BytesDataInput::BytesDataInput(std::string_view buffer, bool copyBuffer, bool isLittleEndian)
 : BytesDataInput(isLittleEndian) {
@@ -28,6 +30,12 @@ BytesDataInput::BytesDataInput(std::string_view buffer, bool copyBuffer, bool is
 
 bool BytesDataInput::hasDataLeft() const noexcept { return mReadPointer < mBufferView.size(); }
 
+bool BytesDataInput::isOverflowed() const noexcept { return mHasOverflowed || mReadPointer > mBufferView.size(); }
+
+bool BytesDataInput::isLittleEndian() const noexcept { return mIsLittleEndian; }
+
+bool BytesDataInput::isValidated() const noexcept { return mIsValidated; }
+
 void BytesDataInput::getBytes(void* target, size_t num) noexcept {
     if (!mHasOverflowed) {
         size_t newPointer = mReadPointer + num;
@@ -40,6 +48,12 @@ void BytesDataInput::getBytes(void* target, size_t num) noexcept {
     }
 }
 
+void BytesDataInput::getSwappedBytes(void* target, size_t count, size_t elementSize) noexcept {
+    if (mHasOverflowed) { return; }
+    getBytes(target, count * elementSize);
+    if (!mIsLittleEndian && !mHasOverflowed) { detail::byteSwap(target, count, elementSize); }
+}
+
 void BytesDataInput::ignoreBytes(size_t length) noexcept { mReadPointer += length; }
 
 size_t BytesDataInput::getPosition() const noexcept { return mReadPointer; }
@@ -6,6 +6,11 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/io/BytesDataOutput.hpp"
+#include "nbt/detail/ByteSwap.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
 
 namespace nbt::io {
 
@@ -17,13 +22,86 @@ BytesDataOutput::BytesDataOutput(std::string& buffer, bool copyBuffer, bool isLi
 : BytesDataInput(buffer, copyBuffer, isLittleEndian),
   mBuffer(buffer) {}
 
+BytesDataOutput::BytesDataOutput(std::span<const std::span<std::byte>> segments, bool isLittleEndian)
+: BytesDataOutput(isLittleEndian) {
+    mSegments = segments;
+}
+
+BytesDataOutput::BytesDataOutput(Sink sink, size_t flushThreshold, bool isLittleEndian)
+: BytesDataOutput(isLittleEndian) {
+    mSink           = std::move(sink);
+    mFlushThreshold = flushThreshold;
+}
+
 std::string BytesDataOutput::getAndReleaseData() { return std::move(mBuffer); }
 
-void BytesDataOutput::writeBytes(const void* origin, size_t num) {
-    mBuffer.append(reinterpret_cast<const char*>(origin), num);
+size_t BytesDataOutput::getWrittenSize() const noexcept {
+    return mSegments.empty() ? mFlushedSize + mBuffer.size() : mSegmentWritten;
+}
+
+void BytesDataOutput::flush() {
+    if (!mSink || mBuffer.empty()) { return; }
+    mSink(mBuffer);
+    mFlushedSize += mBuffer.size();
+    mBuffer.clear();
     mBufferView = mBuffer;
 }
 
+void BytesDataOutput::writeBytes(const void* origin, size_t num) {
+    if (mSegments.empty()) {
+        if (mSink && mBuffer.size() + num > mFlushThreshold) {
+            flush();
+            if (num >= mFlushThreshold) {
+                mSink(std::string_view(static_cast<const char*>(origin), num));
+                mFlushedSize += num;
+                return;
+            }
+        }
+        mBuffer.append(reinterpret_cast<const char*>(origin), num);
+        mBufferView = mBuffer;
+        return;
+    }
+    auto source = static_cast<const std::byte*>(origin);
+    while (num > 0 && !mHasOverflowed) {
+        if (mSegmentIndex >= mSegments.size()) {
+            mHasOverflowed = true;
+            break;
+        }
+        auto segment = mSegments[mSegmentIndex];
+        auto length  = std::min(num, segment.size() - mSegmentOffset);
+        std::memcpy(segment.data() + mSegmentOffset, source, length);
+        source          += length;
+        num             -= length;
+        mSegmentOffset  += length;
+        mSegmentWritten += length;
+        if (mSegmentOffset == segment.size()) {
+            mSegmentIndex++;
+            mSegmentOffset = 0;
+        }
+    }
+}
+
+void BytesDataOutput::writeSwappedBytes(const void* origin, size_t count, size_t elementSize) {
+    if (mIsLittleEndian) {
+        writeBytes(origin, count * elementSize);
+    } else if (mSegments.empty() && !mSink) {
+        auto offset = mBuffer.size();
+        writeBytes(origin, count * elementSize);
+        detail::byteSwap(mBuffer.data() + offset, count, elementSize);
+    } else {
+        std::array<std::byte, 4096> chunk;
+        auto                        source = static_cast<const std::byte*>(origin);
+        for (size_t remaining = count * elementSize; remaining > 0;) {
+            auto length = std::min(remaining, chunk.size());
+            std::memcpy(chunk.data(), source, length);
+            detail::byteSwap(chunk.data(), length / elementSize, elementSize);
+            writeBytes(chunk.data(), length);
+            source    += length;
+            remaining -= length;
+        }
+    }
+}
+
 void BytesDataOutput::writeString(std::string_view value) {
     writeShort(static_cast<int16_t>(value.size()));
     writeBytes(value.data(), value.size());
@@ -61,4 +139,32 @@ void BytesDataOutput::writeInt64(int64_t value) {
     writeBytes(&value, sizeof(int64_t));
 }
 
+void BytesDataOutput::writeIntAt(size_t position, int value) {
+    if (!mIsLittleEndian) { value = bstream::detail::swapEndian(value); }
+    if (mSegments.empty()) {
+        if (position < mFlushedSize) { throw std::out_of_range("position has already been flushed"); }
+        if (position - mFlushedSize > mBuffer.size() || mBuffer.size() - (position - mFlushedSize) < sizeof(int)) {
+            throw std::out_of_range("position is out of range");
+        }
+        std::memcpy(mBuffer.data() + (position - mFlushedSize), &value, sizeof(int));
+        return;
+    }
+    if (position > mSegmentWritten || mSegmentWritten - position < sizeof(int)) {
+        throw std::out_of_range("position is out of range");
+    }
+    auto source = reinterpret_cast<const std::byte*>(&value);
+    for (size_t i = 0, num = sizeof(int); i < mSegments.size() && num > 0; i++) {
+        auto segment = mSegments[i];
+        if (position >= segment.size()) {
+            position -= segment.size();
+            continue;
+        }
+        auto length = std::min(num, segment.size() - position);
+        std::memcpy(segment.data() + position, source, length);
+        source   += length;
+        num      -= length;
+        position  = 0;
+    }
+}
+
 } // namespace nbt::io
@@ -0,0 +1,103 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/io/MappedFile.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nbt::io {
+
+MappedFile::MappedFile(const char* data, size_t size) noexcept : mData(data), mSize(size) {}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+: mData(std::exchange(other.mData, nullptr)),
+  mSize(std::exchange(other.mSize, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        mData = std::exchange(other.mData, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+std::string_view MappedFile::getContent() const noexcept { return std::string_view(mData, mSize); }
+
+size_t MappedFile::getSize() const noexcept { return mSize; }
+
+void MappedFile::unmap() noexcept {
+    if (!mData) { return; }
+#ifdef _WIN32
+    UnmapViewOfFile(mData);
+#else
+    ::munmap(const_cast<char*>(mData), mSize);
+#endif
+    mData = nullptr;
+    mSize = 0;
+}
+
+std::optional<MappedFile> MappedFile::open(std::filesystem::path const& path) {
+#ifdef _WIN32
+    HANDLE hFile = CreateFileW(
+        path.wstring().c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        NULL
+    );
+    if (hFile == INVALID_HANDLE_VALUE) { return std::nullopt; }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(hFile, &size)) {
+        CloseHandle(hFile);
+        return std::nullopt;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(hFile);
+        return MappedFile(nullptr, 0);
+    }
+    HANDLE hMapping = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(hFile);
+    if (!hMapping) { return std::nullopt; }
+    LPVOID mapped = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(hMapping);
+    if (!mapped) { return std::nullopt; }
+    return MappedFile(static_cast<const char*>(mapped), static_cast<size_t>(size.QuadPart));
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) { return std::nullopt; }
+    struct stat sb;
+    if (::fstat(fd, &sb) == -1) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    auto size = static_cast<size_t>(sb.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return MappedFile(nullptr, 0);
+    }
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) { return std::nullopt; }
+    ::madvise(mapped, size, MADV_SEQUENTIAL);
+    return MappedFile(static_cast<const char*>(mapped), size);
+#endif
+}
+
+} // namespace nbt::io
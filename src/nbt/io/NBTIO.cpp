@@ -10,74 +10,227 @@
 #include "nbt/detail/CompressionUtils.hpp"
 #include "nbt/detail/FileUtils.hpp"
 #include "nbt/detail/Validate.hpp"
+#include "nbt/io/MappedFile.hpp"
+#include "nbt/types/NbtView.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <mutex>
+#include <thread>
 
 namespace nbt::io {
 
-constexpr std::byte operator""_byte(unsigned long long value) noexcept { return static_cast<std::byte>(value); }
+namespace {
 
-std::optional<NbtFileFormat> detectContentFormat(std::string_view content, bool strictMatchSize) {
-    if (validateContent(content, NbtFileFormat::LittleEndianWithHeader, strictMatchSize)) {
-        return NbtFileFormat::LittleEndianWithHeader;
-    } else if (validateContent(content, NbtFileFormat::LittleEndian, strictMatchSize)) {
-        return NbtFileFormat::LittleEndian;
-    } else if (validateContent(content, NbtFileFormat::BigEndianWithHeader, strictMatchSize)) {
-        return NbtFileFormat::BigEndianWithHeader;
-    } else if (validateContent(content, NbtFileFormat::BigEndian, strictMatchSize)) {
-        return NbtFileFormat::BigEndian;
-    } else if (validateContent(content, NbtFileFormat::BedrockNetwork, strictMatchSize)) {
-        return NbtFileFormat::BedrockNetwork;
-    } else {
-        return std::nullopt;
+constexpr int Rejected = -1;
+
+constexpr size_t BatchChunkSize = 64;
+
+class ValidatedBytesDataInput : public BytesDataInput {
+public:
+    ValidatedBytesDataInput(std::string_view buffer, bool isLittleEndian)
+    : BytesDataInput(buffer, false, isLittleEndian) {
+        mIsValidated = true;
+    }
+};
+
+struct FormatCandidate {
+    NbtFileFormat mFormat;
+    int           mScore;
+};
+
+template <typename T>
+std::optional<T> peekNumber(std::string_view content, size_t position, bool isLittleEndian) noexcept {
+    if (position > content.size() || content.size() - position < sizeof(T)) { return std::nullopt; }
+    T value;
+    std::memcpy(&value, content.data() + position, sizeof(T));
+    if (!isLittleEndian) { value = bstream::detail::swapEndian(value); }
+    return value;
+}
+
+std::optional<size_t> peekVarInt(std::string_view content, size_t& position) noexcept {
+    size_t value = 0;
+    for (size_t shift = 0; shift < 35 && position < content.size(); shift += 7) {
+        auto byte  = static_cast<uint8_t>(content[position++]);
+        value     |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) { return value; }
+    }
+    return std::nullopt;
+}
+
+Tag::Type peekType(std::string_view content, size_t position) noexcept {
+    return static_cast<Tag::Type>(static_cast<uint8_t>(content[position]));
+}
+
+int keyScore(std::string_view key) noexcept {
+    if (key.empty() || key.size() > 64) { return 0; }
+    return std::ranges::all_of(key, [](char c) { return c >= 0x20 && c < 0x7F; }) ? 2 : 0;
+}
+
+int sniffBinary(std::string_view content, bool isLittleEndian, bool hasHeader, bool strictMatchSize) noexcept {
+    int    score    = 0;
+    size_t position = 0;
+    if (hasHeader) {
+        auto nbtSize = peekNumber<int>(content, sizeof(int), isLittleEndian);
+        if (!nbtSize || *nbtSize < 0) { return Rejected; }
+        auto payloadSize = content.size() - (2 * sizeof(int));
+        if (static_cast<size_t>(*nbtSize) > payloadSize) { return Rejected; }
+        if (static_cast<size_t>(*nbtSize) == payloadSize) { score += 4; }
+        position = 2 * sizeof(int);
+    }
+    if (position >= content.size() || peekType(content, position) != Tag::Type::Compound) { return Rejected; }
+    auto nameLength = peekNumber<int16_t>(content, position + 1, isLittleEndian);
+    position       += 1 + sizeof(int16_t);
+    if (!nameLength || *nameLength < 0 || content.size() - position <= static_cast<size_t>(*nameLength)) {
+        return Rejected;
+    }
+    position  += static_cast<size_t>(*nameLength);
+    auto type  = peekType(content, position++);
+    if (type == Tag::Type::End) {
+        if (position == content.size()) { return score + 2; }
+        return strictMatchSize ? Rejected : score;
+    }
+    if (type >= Tag::Type::NumTagTypes) { return Rejected; }
+    auto keyLength = peekNumber<int16_t>(content, position, isLittleEndian);
+    position      += sizeof(int16_t);
+    if (!keyLength || *keyLength < 0 || content.size() - position < static_cast<size_t>(*keyLength)) {
+        return Rejected;
+    }
+    return score + keyScore(content.substr(position, static_cast<size_t>(*keyLength)));
+}
+
+int sniffNetwork(std::string_view content) noexcept {
+    if (content.empty() || peekType(content, 0) != Tag::Type::Compound) { return Rejected; }
+    size_t position   = 1;
+    auto   nameLength = peekVarInt(content, position);
+    if (!nameLength || content.size() - position <= *nameLength) { return 0; }
+    position  += *nameLength;
+    auto type  = peekType(content, position++);
+    if (type == Tag::Type::End) { return position == content.size() ? 2 : 0; }
+    auto keyLength = peekVarInt(content, position);
+    if (type >= Tag::Type::NumTagTypes || !keyLength || content.size() - position < *keyLength) { return 0; }
+    return keyScore(content.substr(position, *keyLength));
+}
+
+template <typename Function>
+void parallelFor(size_t count, size_t threadCount, Function const& function) {
+    if (threadCount == 0) { threadCount = std::max<size_t>(1, std::thread::hardware_concurrency()); }
+    threadCount = std::min(threadCount, (count + BatchChunkSize - 1) / BatchChunkSize);
+    std::atomic<size_t> next{0};
+    std::exception_ptr  error;
+    std::once_flag      errorFlag;
+
+    auto worker = [&] {
+        try {
+            for (auto begin = next.fetch_add(BatchChunkSize); begin < count; begin = next.fetch_add(BatchChunkSize)) {
+                auto end = std::min(begin + BatchChunkSize, count);
+                for (auto i = begin; i < end; i++) { function(i); }
+            }
+        } catch (...) {
+            std::call_once(errorFlag, [&] { error = std::current_exception(); });
+            next = count;
+        }
+    };
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(threadCount > 0 ? threadCount - 1 : 0);
+        for (size_t i = 1; i < threadCount; i++) { threads.emplace_back(worker); }
+        worker();
+    }
+    if (error) { std::rethrow_exception(error); }
+}
+
+} // namespace
+
+std::optional<std::pair<NbtFileFormat, NbtFormatConfidence>>
+detectContentFormatWithConfidence(std::string_view content, bool strictMatchSize) {
+    std::array<FormatCandidate, 5> candidates{
+        FormatCandidate{NbtFileFormat::LittleEndianWithHeader, sniffBinary(content, true, true, strictMatchSize)},
+        FormatCandidate{NbtFileFormat::LittleEndian, sniffBinary(content, true, false, strictMatchSize)},
+        FormatCandidate{NbtFileFormat::BigEndianWithHeader, sniffBinary(content, false, true, strictMatchSize)},
+        FormatCandidate{NbtFileFormat::BigEndian, sniffBinary(content, false, false, strictMatchSize)},
+        FormatCandidate{NbtFileFormat::BedrockNetwork, sniffNetwork(content)},
+    };
+    auto order = candidates;
+    std::ranges::stable_sort(order, std::ranges::greater{}, &FormatCandidate::mScore);
+    for (size_t i = 0; i < order.size() && order[i].mScore != Rejected; i++) {
+        if (!validateContent(content, order[i].mFormat, strictMatchSize)) { continue; }
+        for (auto const& earlier : candidates) {
+            if (earlier.mFormat == order[i].mFormat) { break; }
+            if (earlier.mScore != Rejected && earlier.mScore < order[i].mScore
+                && validateContent(content, earlier.mFormat, strictMatchSize)) {
+                return std::pair{earlier.mFormat, NbtFormatConfidence::Low};
+            }
+        }
+        auto unique = i == 0 && order[1].mScore < order[0].mScore;
+        return std::pair{order[i].mFormat, unique ? NbtFormatConfidence::High : NbtFormatConfidence::Low};
     }
+    return std::nullopt;
+}
+
+std::optional<NbtFileFormat> detectContentFormat(std::string_view content, bool strictMatchSize) {
+    return detectContentFormatWithConfidence(content, strictMatchSize).transform([](auto const& result) {
+        return result.first;
+    });
 }
 
 std::optional<NbtFileFormat>
 detectFileFormat(std::filesystem::path const& path, bool fileMemoryMap, bool strictMatchSize) {
     if (std::filesystem::exists(path)) {
-        std::string content;
-        detail::readFile(path, content, fileMemoryMap);
-        content.assign(detail::decompress(content));
-        return detectContentFormat(content, strictMatchSize);
+        return detail::visitFileContent(path, fileMemoryMap, [&](std::string_view content) {
+            std::string decompressed;
+            if (detail::detectCompressionType(content) != NbtCompressionType::None) {
+                decompressed = detail::decompress(content);
+                content      = decompressed;
+            }
+            return detectContentFormat(content, strictMatchSize);
+        });
     }
     return std::nullopt;
 }
 
 NbtCompressionType detectFileCompressionType(std::filesystem::path const& path, bool fileMemoryMap) {
     if (std::filesystem::exists(path)) {
-        std::string content;
-        detail::readFile(path, content, fileMemoryMap);
-        if (content.size() > 2) {
-            const auto& b0 = static_cast<std::byte>(static_cast<uint8_t const&>(content[0]));
-            const auto& b1 = static_cast<std::byte>(static_cast<uint8_t const&>(content[1]));
-            if (b0 == 0x1F_byte && b1 == 0x8B_byte) {
-                return NbtCompressionType::Gzip;
-            } else if (b0 == 0x78_byte && (b1 == 0x01_byte || b1 == 0x9C_byte || b1 == 0xDA_byte)) {
-                return NbtCompressionType::Zlib;
-            }
-        }
+        return detail::visitFileContent(path, fileMemoryMap, [](std::string_view content) {
+            return detail::detectCompressionType(content);
+        });
     }
     return NbtCompressionType::None;
 }
 
 NbtCompressionType detectContentCompressionType(std::string_view content) {
-    if (content.size() > 2) {
-        const auto& b0 = static_cast<std::byte>(static_cast<uint8_t const&>(content[0]));
-        const auto& b1 = static_cast<std::byte>(static_cast<uint8_t const&>(content[1]));
-        if (b0 == 0x1F_byte && b1 == 0x8B_byte) {
-            return NbtCompressionType::Gzip;
-        } else if (b0 == 0x78_byte && (b1 == 0x01_byte || b1 == 0x9C_byte || b1 == 0xDA_byte)) {
-            return NbtCompressionType::Zlib;
+    return detail::detectCompressionType(content);
+}
+
+bool isCompressionSupported(NbtCompressionType type) noexcept { return detail::isCompressionSupported(type); }
+
+CompoundTag _parseFromValidatedBinary(std::string_view content, NbtFileFormat format) {
+    if (format == NbtFileFormat::BedrockNetwork) { return CompoundTag::fromNetworkNbt(content); }
+    auto isLittleEndian = format == NbtFileFormat::LittleEndian || format == NbtFileFormat::LittleEndianWithHeader;
+    auto payload        = content;
+    if (format == NbtFileFormat::LittleEndianWithHeader || format == NbtFileFormat::BigEndianWithHeader) {
+        BytesDataInput header(content, false, isLittleEndian);
+        header.ignoreBytes(sizeof(int));
+        payload = header.getLongStringView();
+        if (payload.size() != content.size() - (2 * sizeof(int))) {
+            return CompoundTag::fromBinaryNbt(payload, isLittleEndian);
         }
     }
-    return NbtCompressionType::None;
+    ValidatedBytesDataInput stream(payload, isLittleEndian);
+    CompoundTag result;
+    result.deserialize(stream);
+    return result;
 }
 
 std::optional<CompoundTag>
-_parseFromBinary(std::string& content, std::optional<NbtFileFormat> format, bool strictMatchSize) {
-    content.assign(detail::decompress(content));
-    if (!format.has_value()) { format = detectContentFormat(content, strictMatchSize); }
+_parseFromDecompressed(std::string_view content, std::optional<NbtFileFormat> format, bool strictMatchSize) {
+    auto validated = !format.has_value();
+    if (validated) { format = detectContentFormat(content, strictMatchSize); }
     if (!format.has_value()) { return std::nullopt; }
+    if (validated) { return _parseFromValidatedBinary(content, *format); }
     switch (*format) {
     case NbtFileFormat::LittleEndian: {
         return CompoundTag::fromBinaryNbt(content, true);
@@ -100,23 +253,87 @@ _parseFromBinary(std::string& content, std::optional<NbtFileFormat> format, bool
 }
 
 std::optional<CompoundTag>
-parseFromContent(std::string_view content, std::optional<NbtFileFormat> format, bool strictMatchSize) {
-    std::string input(content);
-    return _parseFromBinary(input, format, strictMatchSize);
+_retainFromDecompressed(std::string&& content, std::optional<NbtFileFormat> format, bool strictMatchSize) {
+    if (!format.has_value()) { format = detectContentFormat(content, strictMatchSize); }
+    if (!format.has_value()) { return std::nullopt; }
+    return CompoundTag::fromSharedBinary(std::make_shared<const std::string>(std::move(content)), *format);
+}
+
+std::optional<CompoundTag> _parseFromBinary(
+    std::string&                 content,
+    std::optional<NbtFileFormat> format,
+    bool                         strictMatchSize,
+    bool                         retainSource = false
+) {
+    if (detail::detectCompressionType(content) != NbtCompressionType::None) { content = detail::decompress(content); }
+    if (retainSource) { return _retainFromDecompressed(std::move(content), format, strictMatchSize); }
+    return _parseFromDecompressed(content, format, strictMatchSize);
+}
+
+std::optional<CompoundTag> parseFromContent(
+    std::string_view             content,
+    std::optional<NbtFileFormat> format,
+    bool                         strictMatchSize,
+    bool                         retainSource
+) {
+    if (detail::detectCompressionType(content) != NbtCompressionType::None) {
+        auto input = detail::decompress(content);
+        if (retainSource) { return _retainFromDecompressed(std::move(input), format, strictMatchSize); }
+        return _parseFromDecompressed(input, format, strictMatchSize);
+    }
+    if (retainSource) { return _retainFromDecompressed(std::string(content), format, strictMatchSize); }
+    return _parseFromDecompressed(content, format, strictMatchSize);
+}
+
+std::vector<std::optional<CompoundTag>> parseBatch(
+    std::span<const std::string_view> contents,
+    std::optional<NbtFileFormat>      format,
+    size_t                            threadCount,
+    bool                              strictMatchSize
+) {
+    std::vector<std::optional<CompoundTag>> result(contents.size());
+    parallelFor(contents.size(), threadCount, [&](size_t index) {
+        result[index] = parseFromContent(contents[index], format, strictMatchSize);
+    });
+    return result;
+}
+
+std::vector<std::optional<CompoundTagVariant>> extract(
+    std::string_view                  content,
+    std::optional<NbtFileFormat>      format,
+    std::span<const std::string_view> paths,
+    bool                              strictMatchSize
+) {
+    std::vector<std::optional<CompoundTagVariant>> result(paths.size());
+    std::string                                    decompressed;
+    if (detectContentCompressionType(content) != NbtCompressionType::None) {
+        decompressed = detail::decompress(content);
+        content      = decompressed;
+    }
+    auto root = CompoundView::fromContent(content, format, strictMatchSize);
+    if (!root) { return result; }
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (auto view = root->query(paths[i])) { result[i] = view->materialize(); }
+    }
+    return result;
 }
 
 std::optional<CompoundTag> parseFromFile(
     std::filesystem::path const& path,
     std::optional<NbtFileFormat> format,
     bool                         fileMemoryMap,
-    bool                         strictMatchSize
+    bool                         strictMatchSize,
+    bool                         retainSource
 ) {
-    if (std::filesystem::exists(path)) {
+    if (!std::filesystem::exists(path)) { return std::nullopt; }
+    if (!fileMemoryMap) {
         std::string content;
-        detail::readFile(path, content, fileMemoryMap);
-        return _parseFromBinary(content, format, strictMatchSize);
+        detail::readFile(path, content, false);
+        return _parseFromBinary(content, format, strictMatchSize, retainSource);
     }
-    return std::nullopt;
+    auto file = MappedFile::open(path);
+    if (!file) { return std::nullopt; }
+    return parseFromContent(file->getContent(), format, strictMatchSize, retainSource);
 }
 
 std::string saveAsBinary(
@@ -152,16 +369,38 @@ std::string saveAsBinary(
         break;
     }
     }
-    switch (compressionType) {
-    case NbtCompressionType::Zlib: {
-        return detail::compress(content, static_cast<int>(compressionLevel), 15);
-    }
-    case NbtCompressionType::Gzip: {
-        return detail::compress(content, static_cast<int>(compressionLevel), 31);
-    }
-    default:
-        return content;
-    }
+    if (compressionType == NbtCompressionType::None) { return content; }
+    return detail::compress(content, compressionType, static_cast<int>(compressionLevel));
+}
+
+std::optional<size_t> saveAsBinary(
+    CompoundTag const&   nbt,
+    std::span<std::byte> output,
+    NbtFileFormat        format,
+    NbtCompressionType   compressionType,
+    NbtCompressionLevel  compressionLevel,
+    std::optional<int>   headerVersion
+) {
+    if (compressionType == NbtCompressionType::None) { return nbt.writeTo(output, format, headerVersion); }
+    auto content = saveAsBinary(nbt, format, compressionType, compressionLevel, headerVersion);
+    if (content.empty() || content.size() > output.size()) { return std::nullopt; }
+    std::memcpy(output.data(), content.data(), content.size());
+    return content.size();
+}
+
+std::vector<std::string> saveBatch(
+    std::span<const CompoundTag> nbts,
+    NbtFileFormat                format,
+    NbtCompressionType           compressionType,
+    NbtCompressionLevel          compressionLevel,
+    std::optional<int>           headerVersion,
+    size_t                       threadCount
+) {
+    std::vector<std::string> result(nbts.size());
+    parallelFor(nbts.size(), threadCount, [&](size_t index) {
+        result[index] = saveAsBinary(nbts[index], format, compressionType, compressionLevel, headerVersion);
+    });
+    return result;
 }
 
 bool saveToFile(
@@ -170,55 +409,34 @@ bool saveToFile(
     NbtFileFormat                format,
     NbtCompressionType           compressionType,
     NbtCompressionLevel          compressionLevel,
-    std::optional<int>           headerVersion
+    std::optional<int>           headerVersion,
+    NbtSaveMode                  saveMode
 ) {
-    std::string content;
     switch (format) {
-    case NbtFileFormat::LittleEndian: {
-        content = nbt.toBinaryNbt(true);
-        break;
-    }
-    case NbtFileFormat::LittleEndianWithHeader: {
-        content = nbt.toBinaryNbtWithHeader(true, headerVersion);
-        break;
-    }
-    case NbtFileFormat::BigEndian: {
-        content = nbt.toBinaryNbt(false);
-        break;
-    }
-    case NbtFileFormat::BigEndianWithHeader: {
-        content = nbt.toBinaryNbtWithHeader(false, headerVersion);
+    case NbtFileFormat::LittleEndian:
+    case NbtFileFormat::LittleEndianWithHeader:
+    case NbtFileFormat::BigEndian:
+    case NbtFileFormat::BigEndianWithHeader:
+    case NbtFileFormat::BedrockNetwork:
         break;
-    }
-    case NbtFileFormat::BedrockNetwork: {
-        content = nbt.toNetworkNbt();
-        break;
-    }
-    default: {
+    default:
         return false;
     }
-    }
     if (!std::filesystem::exists(path.parent_path())) { std::filesystem::create_directories(path.parent_path()); }
-    switch (compressionType) {
-    case NbtCompressionType::Zlib: {
-        content.assign(detail::compress(content, static_cast<int>(compressionLevel), 15));
-        break;
-    }
-    case NbtCompressionType::Gzip: {
-        content.assign(detail::compress(content, static_cast<int>(compressionLevel), 31));
-        break;
-    }
-    default: {
-        break;
-    }
-    }
-    std::ofstream fWrite(path, std::ios::out | std::ios::binary);
-    if (fWrite.is_open()) {
-        fWrite.write(content.data(), static_cast<std::streamsize>(content.size()));
-        fWrite.close();
-        return true;
-    }
-    return false;
+    std::optional<detail::FileWriter> file;
+    auto                              openFile = [&]() -> detail::FileWriter& {
+        if (!file) { file.emplace(path, saveMode); }
+        return *file;
+    };
+    detail::CompressStream stream(
+        compressionType,
+        static_cast<int>(compressionLevel),
+        [&openFile](std::string_view data) { openFile().write(data); }
+    );
+    if (!stream.isReady()) { return false; }
+    nbt.writeTo([&stream](std::string_view data) { stream.write(data); }, format, headerVersion);
+    if (!stream.finish()) { return false; }
+    return openFile().commit();
 }
 
 std::optional<CompoundTag> parseSnbtFromFile(std::filesystem::path const& path) {
@@ -239,10 +457,17 @@ bool saveSnbtToFile(
     std::filesystem::path const& path,
     SnbtFormat                   format,
     uint8_t                      indent,
-    SnbtNumberFormat             nfmt
+    SnbtNumberFormat             nfmt,
+    NbtSaveMode                  saveMode
 ) {
-    std::ofstream fWrite;
     if (!std::filesystem::exists(path.parent_path())) { std::filesystem::create_directories(path.parent_path()); }
+    if (saveMode != NbtSaveMode::Direct) {
+        detail::FileWriter file(path, saveMode);
+        if (!file.isOpen()) { return false; }
+        file.write(nbt.toSnbt(format, indent, nfmt));
+        return file.commit();
+    }
+    std::ofstream fWrite;
     fWrite.open(path, std::ios_base::out);
     if (!fWrite.is_open()) { return false; }
     fWrite << nbt.toSnbt(format, indent, nfmt);
@@ -264,9 +489,9 @@ bool validateContent(std::string_view binary, NbtFileFormat format, bool strictM
         BytesDataInput stream(binary, false, true);
         auto           streamSize = stream.size();
         if (static_cast<Tag::Type>(stream.getByte()) != Tag::Type::Compound) { return false; }
-        if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
         auto strSize = static_cast<size_t>(stream.getShort());
-        if (stream.getPosition() + strSize > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, strSize, 1, streamSize)) { return false; }
         stream.ignoreBytes(strSize);
         if (!detail::validateCompoundTag(stream, streamSize)) { return false; }
         if (strictMatchSize) { return !stream.hasDataLeft(); }
@@ -275,14 +500,14 @@ bool validateContent(std::string_view binary, NbtFileFormat format, bool strictM
     case NbtFileFormat::LittleEndianWithHeader: {
         BytesDataInput stream(binary, false, true);
         auto           streamSize = stream.size();
-        if (stream.getPosition() + (2 * sizeof(int)) > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, 2, sizeof(int), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(int));
         auto nbtSize = static_cast<size_t>(stream.getInt());
-        if (stream.getPosition() + nbtSize > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, nbtSize, 1, streamSize)) { return false; }
         if (static_cast<Tag::Type>(stream.getByte()) != Tag::Type::Compound) { return false; }
-        if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
         auto strSize = static_cast<size_t>(stream.getShort());
-        if (stream.getPosition() + strSize > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, strSize, 1, streamSize)) { return false; }
         stream.ignoreBytes(strSize);
         if (!detail::validateCompoundTag(stream, streamSize)) { return false; }
         if (strictMatchSize) { return !stream.hasDataLeft(); }
@@ -292,9 +517,9 @@ bool validateContent(std::string_view binary, NbtFileFormat format, bool strictM
         BytesDataInput stream(binary, false, false);
         auto           streamSize = stream.size();
         if (static_cast<Tag::Type>(stream.getByte()) != Tag::Type::Compound) { return false; }
-        if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
         auto strSize = static_cast<size_t>(stream.getShort());
-        if (stream.getPosition() + strSize > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, strSize, 1, streamSize)) { return false; }
         stream.ignoreBytes(strSize);
         if (!detail::validateCompoundTag(stream, streamSize)) { return false; }
         if (strictMatchSize) { return !stream.hasDataLeft(); }
@@ -303,14 +528,14 @@ bool validateContent(std::string_view binary, NbtFileFormat format, bool strictM
     case NbtFileFormat::BigEndianWithHeader: {
         BytesDataInput stream(binary, false, false);
         auto           streamSize = stream.size();
-        if (stream.getPosition() + (2 * sizeof(int)) > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, 2, sizeof(int), streamSize)) { return false; }
         stream.ignoreBytes(sizeof(int));
         auto nbtSize = static_cast<size_t>(stream.getInt());
-        if (stream.getPosition() + nbtSize > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, nbtSize, 1, streamSize)) { return false; }
         if (static_cast<Tag::Type>(stream.getByte()) != Tag::Type::Compound) { return false; }
-        if (stream.getPosition() + sizeof(short) > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, 1, sizeof(short), streamSize)) { return false; }
         auto strSize = static_cast<size_t>(stream.getShort());
-        if (stream.getPosition() + strSize > streamSize) { return false; }
+        if (!detail::hasRemaining(stream, strSize, 1, streamSize)) { return false; }
         stream.ignoreBytes(strSize);
         if (!detail::validateCompoundTag(stream, streamSize)) { return false; }
         if (strictMatchSize) { return !stream.hasDataLeft(); }
@@ -335,10 +560,14 @@ bool validateContent(std::string_view binary, NbtFileFormat format, bool strictM
 
 bool validateFile(std::filesystem::path const& path, NbtFileFormat format, bool fileMemoryMap, bool strictMatchSize) {
     if (std::filesystem::exists(path)) {
-        std::string content;
-        detail::readFile(path, content, fileMemoryMap);
-        content.assign(detail::decompress(content));
-        return validateContent(content, format, strictMatchSize);
+        return detail::visitFileContent(path, fileMemoryMap, [&](std::string_view content) {
+            std::string decompressed;
+            if (detail::detectCompressionType(content) != NbtCompressionType::None) {
+                decompressed = detail::decompress(content);
+                content      = decompressed;
+            }
+            return validateContent(content, format, strictMatchSize);
+        });
     }
     return false;
 }
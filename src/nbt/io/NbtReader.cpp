@@ -0,0 +1,312 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/io/NbtReader.hpp"
+#include "nbt/detail/CompressionUtils.hpp"
+#include <array>
+#include <binarystream/ReadOnlyBinaryStream.hpp>
+#include <bit>
+#include <cstring>
+
+namespace nbt::io {
+
+NbtReader::NbtReader(Source source, NbtFileFormat format, size_t bufferSize)
+: mSource(std::move(source)),
+  mFormat(format) {
+    mBuffer.resize(std::max<size_t>(bufferSize, 16));
+}
+
+NbtReader::NbtReader(std::istream& stream, NbtFileFormat format, size_t bufferSize)
+: NbtReader(
+      detail::makeDecompressSource(
+          [&stream](char* buffer, size_t size) -> size_t {
+              stream.read(buffer, static_cast<std::streamsize>(size));
+              return static_cast<size_t>(stream.gcount());
+          },
+          bufferSize
+      ),
+      format,
+      bufferSize
+  ) {}
+
+NbtReader::NbtReader(std::string_view content, NbtFileFormat format)
+: NbtReader(
+      detail::makeDecompressSource(content),
+      format,
+      detail::detectCompressionType(content) == NbtCompressionType::None ? std::min(content.size(), DefaultBufferSize)
+                                                                          : DefaultBufferSize
+  ) {}
+
+bool NbtReader::hasFailed() const noexcept { return mFailed; }
+
+size_t NbtReader::getPosition() const noexcept { return mPosition; }
+
+std::optional<int> NbtReader::getHeaderVersion() const noexcept { return mHeaderVersion; }
+
+bool NbtReader::fill(size_t size) {
+    if (mEnd - mBegin >= size) { return true; }
+    if (mBegin > 0) {
+        std::memmove(mBuffer.data(), mBuffer.data() + mBegin, mEnd - mBegin);
+        mEnd   -= mBegin;
+        mBegin  = 0;
+    }
+    while (mEnd < size && !mEndOfSource) {
+        if (mEnd == mBuffer.size()) { mBuffer.resize(std::min(size, mBuffer.size() * 2)); }
+        auto length = mSource(mBuffer.data() + mEnd, mBuffer.size() - mEnd);
+        if (length == 0) {
+            mEndOfSource = true;
+        } else {
+            mEnd += length;
+        }
+    }
+    if (mEnd < size) {
+        mFailed = true;
+        return false;
+    }
+    return true;
+}
+
+bool NbtReader::read(void* target, size_t size) {
+    if (!fill(size)) { return false; }
+    std::memcpy(target, mBuffer.data() + mBegin, size);
+    mBegin    += size;
+    mPosition += size;
+    return true;
+}
+
+std::optional<uint64_t> NbtReader::readUnsignedVarInt() {
+    uint64_t result = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = 0;
+        if (!read(&byte, sizeof(uint8_t))) { return std::nullopt; }
+        result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) { return result; }
+    }
+    mFailed = true;
+    return std::nullopt;
+}
+
+bool NbtReader::needsSwap() const noexcept {
+    return (mFormat == NbtFileFormat::BigEndian) != (std::endian::native == std::endian::big);
+}
+
+std::optional<uint8_t> NbtReader::readByte() {
+    uint8_t result = 0;
+    if (!read(&result, sizeof(uint8_t))) { return std::nullopt; }
+    return result;
+}
+
+std::optional<int16_t> NbtReader::readShort() {
+    int16_t result = 0;
+    if (!read(&result, sizeof(int16_t))) { return std::nullopt; }
+    if (needsSwap()) { result = bstream::detail::swapEndian(result); }
+    return result;
+}
+
+std::optional<int> NbtReader::readInt() {
+    if (mFormat == NbtFileFormat::BedrockNetwork) {
+        auto value = readUnsignedVarInt();
+        if (!value) { return std::nullopt; }
+        auto bits = static_cast<uint32_t>(*value);
+        return static_cast<int>((bits >> 1) ^ (~(bits & 1) + 1));
+    }
+    int result = 0;
+    if (!read(&result, sizeof(int))) { return std::nullopt; }
+    if (needsSwap()) { result = bstream::detail::swapEndian(result); }
+    return result;
+}
+
+std::optional<int64_t> NbtReader::readLong() {
+    if (mFormat == NbtFileFormat::BedrockNetwork) {
+        auto value = readUnsignedVarInt();
+        if (!value) { return std::nullopt; }
+        return static_cast<int64_t>((*value >> 1) ^ (~(*value & 1) + 1));
+    }
+    int64_t result = 0;
+    if (!read(&result, sizeof(int64_t))) { return std::nullopt; }
+    if (needsSwap()) { result = bstream::detail::swapEndian(result); }
+    return result;
+}
+
+std::optional<float> NbtReader::readFloat() {
+    float result = 0;
+    if (!read(&result, sizeof(float))) { return std::nullopt; }
+    if (needsSwap()) { result = bstream::detail::swapEndian(result); }
+    return result;
+}
+
+std::optional<double> NbtReader::readDouble() {
+    double result = 0;
+    if (!read(&result, sizeof(double))) { return std::nullopt; }
+    if (needsSwap()) { result = bstream::detail::swapEndian(result); }
+    return result;
+}
+
+std::optional<size_t> NbtReader::readLength() {
+    auto length = readInt();
+    if (!length) { return std::nullopt; }
+    if (*length < 0) {
+        mFailed = true;
+        return std::nullopt;
+    }
+    return static_cast<size_t>(*length);
+}
+
+std::optional<std::string_view> NbtReader::readString() {
+    size_t length = 0;
+    if (mFormat == NbtFileFormat::BedrockNetwork) {
+        auto value = readUnsignedVarInt();
+        if (!value) { return std::nullopt; }
+        length = static_cast<size_t>(*value);
+    } else {
+        auto value = readShort();
+        if (!value) { return std::nullopt; }
+        length = static_cast<uint16_t>(*value);
+    }
+    if (!fill(length)) { return std::nullopt; }
+    std::string_view result(mBuffer.data() + mBegin, length);
+    mBegin    += length;
+    mPosition += length;
+    return result;
+}
+
+bool NbtReader::parse(NbtHandler& handler) {
+    if (mFormat == NbtFileFormat::LittleEndianWithHeader || mFormat == NbtFileFormat::BigEndianWithHeader) {
+        mFormat = mFormat == NbtFileFormat::LittleEndianWithHeader ? NbtFileFormat::LittleEndian
+                                                                     : NbtFileFormat::BigEndian;
+        mHeaderVersion = readInt();
+        if (!mHeaderVersion || !readInt()) { return false; }
+    }
+    auto type = readByte();
+    if (!type || *type == static_cast<uint8_t>(Tag::Type::End)) { return false; }
+    auto key = readString();
+    if (!key || !handler.onKey(*key)) { return false; }
+    return readPayload(handler, static_cast<Tag::Type>(*type));
+}
+
+bool NbtReader::readPayload(NbtHandler& handler, Tag::Type type) {
+    switch (type) {
+    case Tag::Type::Byte: {
+        auto value = readByte();
+        return value && handler.onByte(*value);
+    }
+    case Tag::Type::Short: {
+        auto value = readShort();
+        return value && handler.onShort(*value);
+    }
+    case Tag::Type::Int: {
+        auto value = readInt();
+        return value && handler.onInt(*value);
+    }
+    case Tag::Type::Long: {
+        auto value = readLong();
+        return value && handler.onLong(*value);
+    }
+    case Tag::Type::Float: {
+        auto value = readFloat();
+        return value && handler.onFloat(*value);
+    }
+    case Tag::Type::Double: {
+        auto value = readDouble();
+        return value && handler.onDouble(*value);
+    }
+    case Tag::Type::String: {
+        auto value = readString();
+        return value && handler.onString(*value);
+    }
+    case Tag::Type::ByteArray:
+        return readByteArray(handler);
+    case Tag::Type::List:
+        return readList(handler);
+    case Tag::Type::Compound:
+        return readCompound(handler);
+    case Tag::Type::IntArray:
+        return readArray<int>(
+            [this] { return readInt(); },
+            [&](size_t size) { return handler.onIntArrayBegin(size); },
+            [&](std::span<const int> chunk) { return handler.onIntArrayChunk(chunk); },
+            [&] { return handler.onIntArrayEnd(); }
+        );
+    case Tag::Type::LongArray:
+        return readArray<int64_t>(
+            [this] { return readLong(); },
+            [&](size_t size) { return handler.onLongArrayBegin(size); },
+            [&](std::span<const int64_t> chunk) { return handler.onLongArrayChunk(chunk); },
+            [&] { return handler.onLongArrayEnd(); }
+        );
+    default:
+        mFailed = true;
+        return false;
+    }
+}
+
+bool NbtReader::readCompound(NbtHandler& handler) {
+    if (!handler.onCompoundBegin()) { return false; }
+    while (true) {
+        auto type = readByte();
+        if (!type) { return false; }
+        if (*type == static_cast<uint8_t>(Tag::Type::End)) { break; }
+        auto key = readString();
+        if (!key || !handler.onKey(*key)) { return false; }
+        if (!readPayload(handler, static_cast<Tag::Type>(*type))) { return false; }
+    }
+    return handler.onCompoundEnd();
+}
+
+bool NbtReader::readList(NbtHandler& handler) {
+    auto type = readByte();
+    if (!type) { return false; }
+    auto size = readLength();
+    if (!size) { return false; }
+    auto elementType = static_cast<Tag::Type>(*type);
+    if (elementType >= Tag::Type::NumTagTypes) {
+        mFailed = true;
+        return false;
+    }
+    if (!handler.onListBegin(elementType, *size)) { return false; }
+    if (elementType != Tag::Type::End) {
+        for (size_t i = 0; i < *size; i++) {
+            if (!readPayload(handler, elementType)) { return false; }
+        }
+    }
+    return handler.onListEnd();
+}
+
+bool NbtReader::readByteArray(NbtHandler& handler) {
+    auto size = readLength();
+    if (!size || !handler.onByteArrayBegin(*size)) { return false; }
+    for (size_t remaining = *size; remaining > 0;) {
+        auto length = std::min(remaining, mBuffer.size());
+        if (!fill(length)) { return false; }
+        std::span chunk(reinterpret_cast<const uint8_t*>(mBuffer.data() + mBegin), length);
+        mBegin    += length;
+        mPosition += length;
+        remaining -= length;
+        if (!handler.onByteArrayChunk(chunk)) { return false; }
+    }
+    return handler.onByteArrayEnd();
+}
+
+template <typename T, typename Reader, typename Begin, typename Chunk, typename End>
+bool NbtReader::readArray(Reader&& reader, Begin&& onBegin, Chunk&& onChunk, End&& onEnd) {
+    auto size = readLength();
+    if (!size || !onBegin(*size)) { return false; }
+    std::array<T, ArrayChunkSize> chunk;
+    for (size_t remaining = *size; remaining > 0;) {
+        auto length = std::min(remaining, ArrayChunkSize);
+        for (size_t i = 0; i < length; i++) {
+            auto value = reader();
+            if (!value) { return false; }
+            chunk[i] = *value;
+        }
+        remaining -= length;
+        if (!onChunk(std::span<const T>(chunk.data(), length))) { return false; }
+    }
+    return onEnd();
+}
+
+} // namespace nbt::io
@@ -0,0 +1,335 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/io/NbtWriter.hpp"
+#include <stdexcept>
+
+namespace nbt::io {
+
+namespace {
+
+NbtFileFormat baseFormat(NbtFileFormat format) noexcept {
+    switch (format) {
+    case NbtFileFormat::LittleEndianWithHeader:
+        return NbtFileFormat::LittleEndian;
+    case NbtFileFormat::BigEndianWithHeader:
+        return NbtFileFormat::BigEndian;
+    default:
+        return format;
+    }
+}
+
+void writeType(BytesDataOutput& stream, Tag::Type type) { stream.writeByte(static_cast<uint8_t>(type)); }
+void writeType(bstream::BinaryStream& stream, Tag::Type type) { stream.writeByte(static_cast<std::byte>(type)); }
+
+void writeLength(BytesDataOutput& stream, size_t size) { stream.writeInt(static_cast<int>(size)); }
+void writeLength(bstream::BinaryStream& stream, size_t size) { stream.writeVarInt(static_cast<int>(size)); }
+
+void writeByteValue(BytesDataOutput& stream, uint8_t value) { stream.writeByte(value); }
+void writeByteValue(bstream::BinaryStream& stream, uint8_t value) { stream.writeUnsignedChar(value); }
+
+void writeShortValue(BytesDataOutput& stream, int16_t value) { stream.writeShort(value); }
+void writeShortValue(bstream::BinaryStream& stream, int16_t value) { stream.writeSignedShort(value); }
+
+void writeIntValue(BytesDataOutput& stream, int value) { stream.writeInt(value); }
+void writeIntValue(bstream::BinaryStream& stream, int value) { stream.writeVarInt(value); }
+
+void writeLongValue(BytesDataOutput& stream, int64_t value) { stream.writeInt64(value); }
+void writeLongValue(bstream::BinaryStream& stream, int64_t value) { stream.writeVarInt64(value); }
+
+void writeBytesValue(BytesDataOutput& stream, std::span<const uint8_t> value) {
+    stream.writeBytes(value.data(), value.size());
+}
+void writeBytesValue(bstream::BinaryStream& stream, std::span<const uint8_t> value) {
+    for (auto data : value) { stream.writeUnsignedChar(data); }
+}
+
+} // namespace
+
+NbtWriter::NbtWriter(NbtFileFormat format, int headerVersion) : NbtWriter(Sink{}, format, headerVersion, 0) {}
+
+NbtWriter::NbtWriter(Sink sink, NbtFileFormat format, int headerVersion, size_t flushThreshold)
+: mFormat(baseFormat(format)),
+  mSink(std::move(sink)),
+  mFlushThreshold(flushThreshold),
+  mStream(mBuffer, false, mFormat != NbtFileFormat::BigEndian),
+  mNetworkStream(mBuffer, false),
+  mHasHeader(format != mFormat) {
+    if (mHasHeader) {
+        mStream.writeInt(headerVersion);
+        mStream.writeInt(0);
+    }
+}
+
+NbtWriter::NbtWriter(std::ostream& stream, NbtFileFormat format, int headerVersion, size_t flushThreshold)
+: NbtWriter(
+      [&stream](std::string_view data) { stream.write(data.data(), static_cast<std::streamsize>(data.size())); },
+      format,
+      headerVersion,
+      flushThreshold
+  ) {}
+
+NbtWriter::NbtWriter(BytesDataOutput& stream, NbtFileFormat format, int headerVersion)
+: NbtWriter(
+      [&stream](std::string_view data) { stream.writeBytes(data.data(), data.size()); },
+      format,
+      headerVersion,
+      DefaultFlushThreshold
+  ) {}
+
+void NbtWriter::beginValue(Tag::Type type) {
+    if (mScopes.empty()) {
+        beginValue(type, {});
+        return;
+    }
+    auto& scope = mScopes.back();
+    if (scope.mType != Tag::Type::List) { throw std::runtime_error("tag in a compound requires a key"); }
+    if (scope.mElementType != type) { throw std::runtime_error("list element type mismatch"); }
+    if (scope.mRemaining == 0) { throw std::runtime_error("list element count exceeded"); }
+    scope.mRemaining--;
+}
+
+void NbtWriter::beginValue(Tag::Type type, std::string_view key) {
+    if (mScopes.empty()) {
+        if (mHasRoot) { throw std::runtime_error("root tag has already been written"); }
+        mHasRoot = true;
+    } else if (mScopes.back().mType != Tag::Type::Compound) {
+        throw std::runtime_error("named tag can only be written into a compound");
+    }
+    encode([&](auto& stream) {
+        writeType(stream, type);
+        stream.writeString(key);
+    });
+}
+
+void NbtWriter::endValue() {
+    if (!mHasHeader && mSink && mBuffer.size() >= mFlushThreshold) { flush(); }
+}
+
+void NbtWriter::beginCompound() {
+    beginValue(Tag::Type::Compound);
+    mScopes.push_back({Tag::Type::Compound, Tag::Type::End, 0});
+}
+
+void NbtWriter::beginCompound(std::string_view key) {
+    beginValue(Tag::Type::Compound, key);
+    mScopes.push_back({Tag::Type::Compound, Tag::Type::End, 0});
+}
+
+void NbtWriter::endCompound() {
+    if (mScopes.empty() || mScopes.back().mType != Tag::Type::Compound) {
+        throw std::runtime_error("no compound to end");
+    }
+    mScopes.pop_back();
+    encode([](auto& stream) { writeType(stream, Tag::Type::End); });
+    endValue();
+}
+
+void NbtWriter::beginList(Tag::Type type, size_t count) {
+    beginValue(Tag::Type::List);
+    mScopes.push_back({Tag::Type::List, type, count});
+    encode([&](auto& stream) {
+        writeType(stream, type);
+        writeLength(stream, count);
+    });
+}
+
+void NbtWriter::beginList(std::string_view key, Tag::Type type, size_t count) {
+    beginValue(Tag::Type::List, key);
+    mScopes.push_back({Tag::Type::List, type, count});
+    encode([&](auto& stream) {
+        writeType(stream, type);
+        writeLength(stream, count);
+    });
+}
+
+void NbtWriter::endList() {
+    if (mScopes.empty() || mScopes.back().mType != Tag::Type::List) { throw std::runtime_error("no list to end"); }
+    if (mScopes.back().mRemaining != 0) { throw std::runtime_error("list ended before all elements were written"); }
+    mScopes.pop_back();
+    endValue();
+}
+
+void NbtWriter::writeByte(uint8_t value) {
+    beginValue(Tag::Type::Byte);
+    encode([&](auto& stream) { writeByteValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeByte(std::string_view key, uint8_t value) {
+    beginValue(Tag::Type::Byte, key);
+    encode([&](auto& stream) { writeByteValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeShort(int16_t value) {
+    beginValue(Tag::Type::Short);
+    encode([&](auto& stream) { writeShortValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeShort(std::string_view key, int16_t value) {
+    beginValue(Tag::Type::Short, key);
+    encode([&](auto& stream) { writeShortValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeInt(int value) {
+    beginValue(Tag::Type::Int);
+    encode([&](auto& stream) { writeIntValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeInt(std::string_view key, int value) {
+    beginValue(Tag::Type::Int, key);
+    encode([&](auto& stream) { writeIntValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeLong(int64_t value) {
+    beginValue(Tag::Type::Long);
+    encode([&](auto& stream) { writeLongValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeLong(std::string_view key, int64_t value) {
+    beginValue(Tag::Type::Long, key);
+    encode([&](auto& stream) { writeLongValue(stream, value); });
+    endValue();
+}
+
+void NbtWriter::writeFloat(float value) {
+    beginValue(Tag::Type::Float);
+    encode([&](auto& stream) { stream.writeFloat(value); });
+    endValue();
+}
+
+void NbtWriter::writeFloat(std::string_view key, float value) {
+    beginValue(Tag::Type::Float, key);
+    encode([&](auto& stream) { stream.writeFloat(value); });
+    endValue();
+}
+
+void NbtWriter::writeDouble(double value) {
+    beginValue(Tag::Type::Double);
+    encode([&](auto& stream) { stream.writeDouble(value); });
+    endValue();
+}
+
+void NbtWriter::writeDouble(std::string_view key, double value) {
+    beginValue(Tag::Type::Double, key);
+    encode([&](auto& stream) { stream.writeDouble(value); });
+    endValue();
+}
+
+void NbtWriter::writeString(std::string_view value) {
+    beginValue(Tag::Type::String);
+    encode([&](auto& stream) { stream.writeString(value); });
+    endValue();
+}
+
+void NbtWriter::writeString(std::string_view key, std::string_view value) {
+    beginValue(Tag::Type::String, key);
+    encode([&](auto& stream) { stream.writeString(value); });
+    endValue();
+}
+
+void NbtWriter::writeByteArray(std::span<const uint8_t> value) {
+    beginValue(Tag::Type::ByteArray);
+    encode([&](auto& stream) {
+        writeLength(stream, value.size());
+        writeBytesValue(stream, value);
+    });
+    endValue();
+}
+
+void NbtWriter::writeByteArray(std::string_view key, std::span<const uint8_t> value) {
+    beginValue(Tag::Type::ByteArray, key);
+    encode([&](auto& stream) {
+        writeLength(stream, value.size());
+        writeBytesValue(stream, value);
+    });
+    endValue();
+}
+
+void NbtWriter::writeIntArray(std::span<const int> value) {
+    beginValue(Tag::Type::IntArray);
+    encode([&](auto& stream) {
+        writeLength(stream, value.size());
+        for (auto data : value) { writeIntValue(stream, data); }
+    });
+    endValue();
+}
+
+void NbtWriter::writeIntArray(std::string_view key, std::span<const int> value) {
+    beginValue(Tag::Type::IntArray, key);
+    encode([&](auto& stream) {
+        writeLength(stream, value.size());
+        for (auto data : value) { writeIntValue(stream, data); }
+    });
+    endValue();
+}
+
+void NbtWriter::writeLongArray(std::span<const int64_t> value) {
+    beginValue(Tag::Type::LongArray);
+    encode([&](auto& stream) {
+        writeLength(stream, value.size());
+        for (auto data : value) { writeLongValue(stream, data); }
+    });
+    endValue();
+}
+
+void NbtWriter::writeLongArray(std::string_view key, std::span<const int64_t> value) {
+    beginValue(Tag::Type::LongArray, key);
+    encode([&](auto& stream) {
+        writeLength(stream, value.size());
+        for (auto data : value) { writeLongValue(stream, data); }
+    });
+    endValue();
+}
+
+void NbtWriter::writeTag(Tag const& tag) {
+    beginValue(tag.getType());
+    encode([&](auto& stream) { tag.write(stream); });
+    endValue();
+}
+
+void NbtWriter::writeTag(std::string_view key, Tag const& tag) {
+    beginValue(tag.getType(), key);
+    encode([&](auto& stream) { tag.write(stream); });
+    endValue();
+}
+
+NbtWriter::~NbtWriter() {
+    if (mSink && !mFinished && mHasRoot && mScopes.empty()) { finish(); }
+}
+
+void NbtWriter::flush() {
+    if (!mSink || mBuffer.empty() || (mHasHeader && !mFinished)) { return; }
+    mSink(mBuffer);
+    mFlushedSize += mBuffer.size();
+    mBuffer.clear();
+}
+
+void NbtWriter::finish() {
+    if (mFinished) { return; }
+    if (!mHasRoot || !mScopes.empty()) { throw std::runtime_error("nbt writer finished with unclosed tags"); }
+    if (mHasHeader) {
+        mStream.writeIntAt(sizeof(int), static_cast<int>(mBuffer.size() - (2 * sizeof(int))));
+    }
+    mFinished = true;
+    flush();
+}
+
+size_t NbtWriter::getWrittenSize() const noexcept { return mFlushedSize + mBuffer.size(); }
+
+std::string NbtWriter::getAndReleaseData() {
+    finish();
+    return std::move(mBuffer);
+}
+
+} // namespace nbt::io
@@ -0,0 +1,121 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/io/SaveScheduler.hpp"
+#include "nbt/io/NBTIO.hpp"
+#include <algorithm>
+
+namespace nbt::io {
+
+SaveScheduler::SaveScheduler(size_t threadCount) {
+    if (threadCount == 0) { threadCount = std::max<size_t>(1, std::thread::hardware_concurrency()); }
+    mWorkers.reserve(threadCount);
+    try {
+        for (size_t i = 0; i < threadCount; i++) { mWorkers.emplace_back([this] { run(); }); }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+SaveScheduler::~SaveScheduler() { stop(); }
+
+std::shared_future<bool> SaveScheduler::enqueue(
+    CompoundTag                  nbt,
+    std::filesystem::path const& path,
+    NbtFileFormat                format,
+    NbtCompressionType           compressionType,
+    NbtCompressionLevel          compressionLevel,
+    std::optional<int>           headerVersion,
+    NbtSaveMode                  saveMode
+) {
+    return schedule(path, [=, nbt = std::move(nbt)] {
+        return saveToFile(nbt, path, format, compressionType, compressionLevel, headerVersion, saveMode);
+    });
+}
+
+std::shared_future<bool> SaveScheduler::enqueueSnbt(
+    CompoundTag                  nbt,
+    std::filesystem::path const& path,
+    SnbtFormat                   format,
+    uint8_t                      indent,
+    SnbtNumberFormat             nbtNumberFormat,
+    NbtSaveMode                  saveMode
+) {
+    return schedule(path, [=, nbt = std::move(nbt)] {
+        return saveSnbtToFile(nbt, path, format, indent, nbtNumberFormat, saveMode);
+    });
+}
+
+std::shared_future<bool> SaveScheduler::schedule(std::filesystem::path const& path, Task task) {
+    auto            key = std::filesystem::absolute(path).lexically_normal().string();
+    std::lock_guard lock(mMutex);
+    if (auto iter = mPending.find(key); iter != mPending.end()) {
+        iter->second->mTask = std::move(task);
+        return iter->second->mFuture;
+    }
+    auto& job   = mQueue.emplace_back();
+    job.mKey    = key;
+    job.mTask   = std::move(task);
+    job.mFuture = job.mPromise.get_future().share();
+    mPending.emplace(std::move(key), std::prev(mQueue.end()));
+    mWakeup.notify_one();
+    return job.mFuture;
+}
+
+void SaveScheduler::flush() {
+    std::unique_lock lock(mMutex);
+    mIdle.wait(lock, [this] { return mQueue.empty() && mBusy.empty(); });
+}
+
+size_t SaveScheduler::getPendingCount() const {
+    std::lock_guard lock(mMutex);
+    return mQueue.size() + mBusy.size();
+}
+
+size_t SaveScheduler::getThreadCount() const noexcept { return mWorkers.size(); }
+
+void SaveScheduler::stop() noexcept {
+    {
+        std::lock_guard lock(mMutex);
+        mStopping = true;
+    }
+    mWakeup.notify_all();
+    for (auto& worker : mWorkers) {
+        if (worker.joinable()) { worker.join(); }
+    }
+}
+
+void SaveScheduler::run() {
+    std::unique_lock lock(mMutex);
+    while (true) {
+        auto next = mQueue.end();
+        mWakeup.wait(lock, [&] {
+            next = std::find_if(mQueue.begin(), mQueue.end(), [this](Job const& job) {
+                return !mBusy.contains(job.mKey);
+            });
+            return next != mQueue.end() || mStopping;
+        });
+        if (next == mQueue.end()) { return; }
+        auto job = std::move(*next);
+        mPending.erase(job.mKey);
+        mQueue.erase(next);
+        mBusy.insert(job.mKey);
+        lock.unlock();
+        try {
+            job.mPromise.set_value(job.mTask());
+        } catch (...) {
+            job.mPromise.set_exception(std::current_exception());
+        }
+        lock.lock();
+        mBusy.erase(job.mKey);
+        if (mQueue.empty() && mBusy.empty()) { mIdle.notify_all(); }
+        if (!mQueue.empty()) { mWakeup.notify_all(); }
+    }
+}
+
+} // namespace nbt::io
@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/types/CompoundTag.hpp"
+#include "nbt/detail/TagCodec.hpp"
 #include "nbt/io/NBTIO.hpp"
 #include "nbt/types/ByteArrayTag.hpp"
 #include "nbt/types/ByteTag.hpp"
@@ -25,6 +26,187 @@
 
 namespace nbt {
 
+namespace {
+
+constexpr size_t SinkFlushThreshold = 64 * 1024;
+
+size_t unsignedVarIntSize(uint64_t value) noexcept {
+    size_t size = 1;
+    for (; value >= 0x80; value >>= 7) { size++; }
+    return size;
+}
+
+size_t varIntSize(int value) noexcept {
+    auto bits = static_cast<uint32_t>(value);
+    return unsignedVarIntSize((bits << 1) ^ (0 - (bits >> 31)));
+}
+
+size_t varInt64Size(int64_t value) noexcept {
+    auto bits = static_cast<uint64_t>(value);
+    return unsignedVarIntSize((bits << 1) ^ (0 - (bits >> 63)));
+}
+
+size_t stringSize(std::string_view value, bool isNetwork) noexcept {
+    return (isNetwork ? unsignedVarIntSize(value.size()) : sizeof(int16_t)) + value.size();
+}
+
+size_t lengthSize(size_t size, bool isNetwork) noexcept {
+    return isNetwork ? varIntSize(static_cast<int>(size)) : sizeof(int);
+}
+
+size_t payloadSize(CompoundTagVariant const& tag, NbtFileFormat format) noexcept;
+
+size_t packedListSize(ListTag const& tag, bool isNetwork) {
+    switch (tag.getElementType()) {
+    case Tag::Type::Byte:
+        return sizeof(uint8_t) * tag.size();
+    case Tag::Type::Short:
+        return sizeof(int16_t) * tag.size();
+    case Tag::Type::Int: {
+        if (!isNetwork) { return sizeof(int) * tag.size(); }
+        size_t size = 0;
+        for (auto data : tag.values<int>()) { size += varIntSize(data); }
+        return size;
+    }
+    case Tag::Type::Long: {
+        if (!isNetwork) { return sizeof(int64_t) * tag.size(); }
+        size_t size = 0;
+        for (auto data : tag.values<int64_t>()) { size += varInt64Size(data); }
+        return size;
+    }
+    case Tag::Type::Float:
+        return sizeof(float) * tag.size();
+    case Tag::Type::Double:
+        return sizeof(double) * tag.size();
+    default:
+        return 0;
+    }
+}
+
+size_t compoundPayloadSize(CompoundTag const& tag, NbtFileFormat format) noexcept {
+    if (tag.getSourceFormat() == format) { return tag.getSourcePayload().size(); }
+    bool   isNetwork = format == NbtFileFormat::BedrockNetwork;
+    size_t size      = sizeof(uint8_t);
+    for (auto const& [key, value] : tag) {
+        if (value.hold(Tag::Type::End)) { continue; }
+        size += sizeof(uint8_t) + stringSize(key, isNetwork) + payloadSize(value, format);
+    }
+    return size;
+}
+
+size_t payloadSize(CompoundTagVariant const& tag, NbtFileFormat format) noexcept {
+    bool isNetwork = format == NbtFileFormat::BedrockNetwork;
+    return std::visit(
+        [&](auto const& value) -> size_t {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, ByteTag>) {
+                return sizeof(uint8_t);
+            } else if constexpr (std::is_same_v<T, ShortTag>) {
+                return sizeof(int16_t);
+            } else if constexpr (std::is_same_v<T, IntTag>) {
+                return isNetwork ? varIntSize(value.storage()) : sizeof(int);
+            } else if constexpr (std::is_same_v<T, LongTag>) {
+                return isNetwork ? varInt64Size(value.storage()) : sizeof(int64_t);
+            } else if constexpr (std::is_same_v<T, FloatTag>) {
+                return sizeof(float);
+            } else if constexpr (std::is_same_v<T, DoubleTag>) {
+                return sizeof(double);
+            } else if constexpr (std::is_same_v<T, StringTag>) {
+                return stringSize(value.storage(), isNetwork);
+            } else if constexpr (std::is_same_v<T, ByteArrayTag>) {
+                return lengthSize(value.size(), isNetwork) + value.size();
+            } else if constexpr (std::is_same_v<T, IntArrayTag>) {
+                if (!isNetwork) { return sizeof(int) + (sizeof(int) * value.size()); }
+                size_t size = lengthSize(value.size(), isNetwork);
+                for (auto data : value.storage()) { size += varIntSize(data); }
+                return size;
+            } else if constexpr (std::is_same_v<T, LongArrayTag>) {
+                if (!isNetwork) { return sizeof(int) + (sizeof(int64_t) * value.size()); }
+                size_t size = lengthSize(value.size(), isNetwork);
+                for (auto data : value.storage()) { size += varInt64Size(data); }
+                return size;
+            } else if constexpr (std::is_same_v<T, ListTag>) {
+                size_t size = sizeof(uint8_t) + lengthSize(value.size(), isNetwork);
+                if (value.isPacked()) { return size + packedListSize(value, isNetwork); }
+                for (auto const& element : value) { size += payloadSize(element, format); }
+                return size;
+            } else if constexpr (std::is_same_v<T, CompoundTag>) {
+                return compoundPayloadSize(value, format);
+            } else {
+                return 0;
+            }
+        },
+        tag.mStorage
+    );
+}
+
+bool hasHeader(NbtFileFormat format) noexcept {
+    return format == NbtFileFormat::LittleEndianWithHeader || format == NbtFileFormat::BigEndianWithHeader;
+}
+
+bool isLittleEndianFormat(NbtFileFormat format) noexcept {
+    return format == NbtFileFormat::LittleEndian || format == NbtFileFormat::LittleEndianWithHeader;
+}
+
+NbtFileFormat baseFormat(bool isLittleEndian) noexcept {
+    return isLittleEndian ? NbtFileFormat::LittleEndian : NbtFileFormat::BigEndian;
+}
+
+int resolveHeaderVersion(CompoundTag const& tag, std::optional<int> headerVersion) {
+    if (headerVersion.has_value()) { return *headerVersion; }
+    if (tag.contains("StorageVersion", Tag::Type::Int)) { return tag.at("StorageVersion"); }
+    return 0;
+}
+
+struct SourceScope {
+    std::shared_ptr<const void> mOwner;
+    std::string_view            mView;
+    NbtFileFormat               mFormat;
+    SourceScope*                mPrevious;
+
+    SourceScope(std::shared_ptr<const void> owner, std::string_view view, NbtFileFormat format);
+    ~SourceScope();
+
+    SourceScope(SourceScope const&)            = delete;
+    SourceScope& operator=(SourceScope const&) = delete;
+};
+
+thread_local SourceScope* currentSource = nullptr;
+
+SourceScope::SourceScope(std::shared_ptr<const void> owner, std::string_view view, NbtFileFormat format)
+: mOwner(std::move(owner)),
+  mView(view),
+  mFormat(format),
+  mPrevious(currentSource) {
+    currentSource = this;
+}
+
+SourceScope::~SourceScope() { currentSource = mPrevious; }
+
+std::unique_ptr<const CompoundTag::Source> retainSource(size_t begin, size_t end) {
+    if (end > currentSource->mView.size() || begin > end) { return nullptr; }
+    auto payload = currentSource->mView.substr(begin, end - begin);
+    return std::make_unique<const CompoundTag::Source>(
+        CompoundTag::Source{currentSource->mOwner, payload, currentSource->mFormat}
+    );
+}
+
+} // namespace
+
+CompoundTag::CompoundTag(CompoundTag const& other) : mTagMap(other.mTagMap) {}
+
+CompoundTag::CompoundTag(CompoundTag&& other) noexcept = default;
+
+CompoundTag& CompoundTag::operator=(CompoundTag const& other) {
+    if (this != &other) {
+        mTagMap = other.mTagMap;
+        mSource.reset();
+    }
+    return *this;
+}
+
+CompoundTag& CompoundTag::operator=(CompoundTag&& other) noexcept = default;
+
 bool CompoundTag::equals(Tag const& other) const {
     if (other.getType() != Type::Compound) { return false; }
     const auto& otherTag = static_cast<const CompoundTag&>(other);
@@ -38,12 +220,12 @@ bool CompoundTag::equals(Tag const& other) const {
 std::unique_ptr<Tag> CompoundTag::copy() const { return clone(); }
 
 std::size_t CompoundTag::hash() const {
-    size_t           hash   = 0x811c9dc5;
-    constexpr size_t prime  = 0x01000193;
-    auto             binary = toBinaryNbt();
-    for (char byte : binary) {
-        hash ^= static_cast<size_t>(byte);
-        hash  = hash * prime;
+    std::size_t hash = 0;
+    for (const auto& [key, value] : mTagMap) {
+        if (value.hold(Type::End)) { continue; }
+        std::size_t element_hash  = std::hash<std::string>{}(key);
+        element_hash             ^= value.hash() + 0x9e3779b9 + (element_hash << 6) + (element_hash >> 2);
+        hash                     += element_hash;
     }
     return hash;
 }
@@ -52,69 +234,57 @@ Tag::Type CompoundTag::getType() const { return Type::Compound; }
 
 std::unique_ptr<CompoundTag> CompoundTag::clone() const {
     auto tag = std::make_unique<CompoundTag>();
+    tag->mTagMap.reserve(mTagMap.size());
     for (const auto& [key, value] : mTagMap) { tag->mTagMap.emplace(key, value.toUniqueCopy()); }
     return tag;
 }
 
 void CompoundTag::write(io::BytesDataOutput& stream) const {
-    for (const auto& [key, tag] : mTagMap) {
-        auto type = tag->getType();
-        if (type != Type::End) {
-            stream.writeByte(static_cast<uint8_t>(type));
-            stream.writeString(key);
-            tag->write(stream);
-        }
+    if (mSource && mSource->mFormat == baseFormat(stream.isLittleEndian())) {
+        stream.writeBytes(mSource->mPayload.data(), mSource->mPayload.size());
+        return;
     }
-    stream.writeByte(static_cast<uint8_t>(Type::End));
+    detail::visitCodec(stream, [&]<typename C>(C) { C::writeEntries(stream, mTagMap); });
 }
 
 void CompoundTag::load(io::BytesDataInput& stream) {
-    while (true) {
-        const auto type = static_cast<Type>(stream.getByte());
-        if (type == Type::End) { return; }
-        auto key = stream.getStringView();
-        if (auto tagPtr = Tag::newTag(type)) {
-            tagPtr->load(stream);
-            mTagMap.emplace(std::move(key), std::move(*tagPtr));
-        }
-    }
+    auto start  = stream.getPosition();
+    auto retain = currentSource && mTagMap.empty();
+    mSource.reset();
+    detail::visitCodec(stream, [&]<typename C>(C) { C::loadEntries(stream, mTagMap); });
+    if (retain && !stream.isOverflowed()) { mSource = retainSource(start, stream.getPosition()); }
 }
 
 void CompoundTag::write(bstream::BinaryStream& stream) const {
-    for (const auto& [key, tag] : mTagMap) {
-        auto type = tag->getType();
-        if (type != Type::End) {
-            stream.writeUnsignedChar(static_cast<uint8_t>(type));
-            stream.writeString(key);
-            tag->write(stream);
-        }
+    if (mSource && mSource->mFormat == NbtFileFormat::BedrockNetwork) {
+        stream.writeBytes(mSource->mPayload.data(), mSource->mPayload.size());
+        return;
     }
-    stream.writeUnsignedChar(static_cast<uint8_t>(Type::End));
+    detail::visitCodec(stream, [&]<typename C>(C) { C::writeEntries(stream, mTagMap); });
 }
 
 void CompoundTag::load(bstream::ReadOnlyBinaryStream& stream) {
-    while (true) {
-        const auto type = static_cast<Type>(stream.getByte());
-        if (type == Type::End) { return; }
-        auto key = stream.getStringView();
-        if (auto tagPtr = Tag::newTag(type)) {
-            tagPtr->load(stream);
-            mTagMap.emplace(std::move(key), std::move(*tagPtr));
-        }
-    }
+    auto start  = stream.getPosition();
+    auto retain = currentSource && mTagMap.empty();
+    mSource.reset();
+    detail::visitCodec(stream, [&]<typename C>(C) { C::loadEntries(stream, mTagMap); });
+    if (retain && !stream.isOverflowed()) { mSource = retainSource(start, stream.getPosition()); }
 }
 
 void CompoundTag::merge(CompoundTag const& other, bool mergeList) {
+    markDirty();
     for (auto const& [key, val] : other) { mTagMap[key].merge(val, mergeList); }
 }
 
 bool CompoundTag::put(std::string_view key, Tag&& tag) {
+    markDirty();
     auto [_, result] = mTagMap.emplace(key, std::forward<Tag>(tag));
     return result;
 }
 
 bool CompoundTag::put(std::string_view key, std::unique_ptr<Tag>&& tag) {
     if (tag) {
+        markDirty();
         auto [_, result] = mTagMap.emplace(key, std::move(*tag));
         return result;
     }
@@ -126,53 +296,63 @@ void CompoundTag::set(std::string_view key, Tag&& tag) { operator[](key) = tag;
 void CompoundTag::set(std::string_view key, std::unique_ptr<Tag>&& tag) { operator[](key) = std::move(tag); }
 
 Tag const* CompoundTag::get(std::string_view key) const {
-    if (mTagMap.contains(key)) { return mTagMap.at(std::string(key)).get(); }
+    if (auto iter = mTagMap.find(key); iter != mTagMap.end()) { return iter->second.get(); }
     return nullptr;
 }
 
 Tag* CompoundTag::get(std::string_view key) {
-    if (mTagMap.contains(key)) { return mTagMap.at(std::string(key)).get(); }
+    markDirty();
+    if (auto iter = mTagMap.find(key); iter != mTagMap.end()) { return iter->second.get(); }
     return nullptr;
 }
 
 bool CompoundTag::contains(std::string_view key) const {
-    return mTagMap.contains(key) && !mTagMap.at(std::string(key)).hold(Type::End);
+    auto iter = mTagMap.find(key);
+    return iter != mTagMap.end() && !iter->second.hold(Type::End);
 }
 
 bool CompoundTag::contains(std::string_view key, Tag::Type type) const {
-    if (contains(key)) { return mTagMap.at(std::string(key)).hold(type); }
-    return false;
+    auto iter = mTagMap.find(key);
+    return iter != mTagMap.end() && !iter->second.hold(Type::End) && iter->second.hold(type);
 }
 
 bool CompoundTag::empty() const noexcept { return (size() == 0); }
 
 bool CompoundTag::remove(std::string_view index) {
-    if (mTagMap.contains(index)) {
-        mTagMap.erase(std::string(index));
-        return true;
-    }
-    return false;
+    markDirty();
+    return mTagMap.erase(index) > 0;
 }
 
 bool CompoundTag::rename(std::string_view index, std::string_view newName) {
-    if (contains(index)) {
-        mTagMap[std::string(newName)] = mTagMap.at(std::string(index));
-        remove(index);
-        return true;
-    }
-    return false;
+    markDirty();
+    return contains(index) && mTagMap.rename(index, newName);
 }
 
-void CompoundTag::clear() noexcept { mTagMap.clear(); }
+void CompoundTag::clear() noexcept {
+    markDirty();
+    mTagMap.clear();
+}
 
-CompoundTag::iterator CompoundTag::begin() noexcept { return mTagMap.begin(); }
-CompoundTag::iterator CompoundTag::end() noexcept { return mTagMap.end(); }
+CompoundTag::iterator CompoundTag::begin() noexcept {
+    markDirty();
+    return mTagMap.begin();
+}
+CompoundTag::iterator CompoundTag::end() noexcept {
+    markDirty();
+    return mTagMap.end();
+}
 
 CompoundTag::const_iterator CompoundTag::begin() const noexcept { return cbegin(); }
 CompoundTag::const_iterator CompoundTag::end() const noexcept { return cend(); }
 
-CompoundTag::reverse_iterator CompoundTag::rbegin() noexcept { return mTagMap.rbegin(); }
-CompoundTag::reverse_iterator CompoundTag::rend() noexcept { return mTagMap.rend(); }
+CompoundTag::reverse_iterator CompoundTag::rbegin() noexcept {
+    markDirty();
+    return mTagMap.rbegin();
+}
+CompoundTag::reverse_iterator CompoundTag::rend() noexcept {
+    markDirty();
+    return mTagMap.rend();
+}
 
 CompoundTag::const_iterator CompoundTag::cbegin() const noexcept { return mTagMap.cbegin(); }
 CompoundTag::const_iterator CompoundTag::cend() const noexcept { return mTagMap.cend(); }
@@ -180,17 +360,39 @@ CompoundTag::const_iterator CompoundTag::cend() const noexcept { return mTagMap.
 CompoundTag::const_reverse_iterator CompoundTag::crbegin() const noexcept { return mTagMap.crbegin(); }
 CompoundTag::const_reverse_iterator CompoundTag::crend() const noexcept { return mTagMap.crend(); }
 
-CompoundTag::iterator CompoundTag::erase(const_iterator where) noexcept { return mTagMap.erase(where); }
+CompoundTag::iterator CompoundTag::erase(const_iterator where) noexcept {
+    markDirty();
+    return mTagMap.erase(where);
+}
 CompoundTag::iterator CompoundTag::erase(const_iterator first, const_iterator last) noexcept {
+    markDirty();
     return mTagMap.erase(first, last);
 }
 
-CompoundTag::TagMap&       CompoundTag::items() noexcept { return mTagMap; }
+CompoundTag::TagMap& CompoundTag::items() noexcept {
+    markDirty();
+    return mTagMap;
+}
 CompoundTag::TagMap const& CompoundTag::items() const noexcept { return mTagMap; }
 
-CompoundTag::TagMap&       CompoundTag::storage() noexcept { return mTagMap; }
+CompoundTag::TagMap& CompoundTag::storage() noexcept {
+    markDirty();
+    return mTagMap;
+}
 CompoundTag::TagMap const& CompoundTag::storage() const noexcept { return mTagMap; }
 
+bool CompoundTag::isDirty() const noexcept { return !mSource; }
+
+void CompoundTag::markDirty() noexcept { mSource.reset(); }
+
+std::string_view CompoundTag::getSourcePayload() const noexcept {
+    return mSource ? mSource->mPayload : std::string_view{};
+}
+
+std::optional<NbtFileFormat> CompoundTag::getSourceFormat() const noexcept {
+    return mSource ? std::optional(mSource->mFormat) : std::nullopt;
+}
+
 void CompoundTag::serialize(bstream::BinaryStream& stream) const {
     stream.writeByte(static_cast<std::byte>(Type::Compound));
     stream.writeString("");
@@ -228,24 +430,126 @@ CompoundTag CompoundTag::fromBinaryNbtWithHeader(std::string_view binaryData, bo
     return fromBinaryNbt(stream.getLongStringView(), isLittleEndian);
 }
 
-std::string CompoundTag::toBinaryNbt(bool isLittleEndian) const noexcept {
-    io::BytesDataOutput stream(isLittleEndian);
+size_t CompoundTag::computeBinarySize(NbtFileFormat format) const noexcept {
+    bool isNetwork = format == NbtFileFormat::BedrockNetwork;
+    auto payload   = isNetwork ? format : baseFormat(isLittleEndianFormat(format));
+    auto size      = sizeof(uint8_t) + stringSize("", isNetwork) + compoundPayloadSize(*this, payload);
+    if (hasHeader(format)) { size += 2 * sizeof(int); }
+    return size;
+}
+
+size_t
+CompoundTag::writeTo(std::string& output, NbtFileFormat format, std::optional<int> headerVersion) const noexcept {
+    auto size = computeBinarySize(format);
+    output.reserve(output.size() + size);
+    if (format == NbtFileFormat::BedrockNetwork) {
+        bstream::BinaryStream stream(output, false);
+        serialize(stream);
+        return size;
+    }
+    io::BytesDataOutput stream(output, false, isLittleEndianFormat(format));
+    if (hasHeader(format)) {
+        stream.writeInt(resolveHeaderVersion(*this, headerVersion));
+        stream.writeInt(static_cast<int>(size - (2 * sizeof(int))));
+    }
+    serialize(stream);
+    return size;
+}
+
+std::optional<size_t> CompoundTag::writeTo(
+    std::span<std::byte> output,
+    NbtFileFormat        format,
+    std::optional<int>   headerVersion
+) const noexcept {
+    return writeTo(std::span<const std::span<std::byte>>(&output, 1), format, headerVersion);
+}
+
+std::optional<size_t> CompoundTag::writeTo(
+    std::span<const std::span<std::byte>> output,
+    NbtFileFormat                         format,
+    std::optional<int>                    headerVersion
+) const noexcept {
+    auto   size     = computeBinarySize(format);
+    size_t capacity = 0;
+    for (auto const& segment : output) { capacity += segment.size(); }
+    if (capacity < size) { return std::nullopt; }
+    if (format == NbtFileFormat::BedrockNetwork) {
+        auto                content = toNetworkNbt();
+        io::BytesDataOutput stream(output);
+        stream.writeBytes(content.data(), content.size());
+        return size;
+    }
+    io::BytesDataOutput stream(output, isLittleEndianFormat(format));
+    if (hasHeader(format)) {
+        stream.writeInt(resolveHeaderVersion(*this, headerVersion));
+        stream.writeInt(static_cast<int>(size - (2 * sizeof(int))));
+    }
     serialize(stream);
-    return stream.getAndReleaseData();
+    if (stream.isOverflowed()) { return std::nullopt; }
+    return size;
+}
+
+size_t CompoundTag::writeTo(
+    std::function<void(std::string_view data)> const& sink,
+    NbtFileFormat                                     format,
+    std::optional<int>                                headerVersion
+) const {
+    auto size = computeBinarySize(format);
+    if (format == NbtFileFormat::BedrockNetwork) {
+        sink(toNetworkNbt());
+        return size;
+    }
+    io::BytesDataOutput stream(sink, SinkFlushThreshold, isLittleEndianFormat(format));
+    if (hasHeader(format)) {
+        stream.writeInt(resolveHeaderVersion(*this, headerVersion));
+        stream.writeInt(static_cast<int>(size - (2 * sizeof(int))));
+    }
+    serialize(stream);
+    stream.flush();
+    return size;
+}
+
+std::string CompoundTag::toBinaryNbt(bool isLittleEndian) const noexcept {
+    std::string buffer;
+    writeTo(buffer, isLittleEndian ? NbtFileFormat::LittleEndian : NbtFileFormat::BigEndian);
+    return buffer;
 }
 
 std::string CompoundTag::toBinaryNbtWithHeader(bool isLittleEndian, std::optional<int> storageVersion) const noexcept {
-    io::BytesDataOutput stream(isLittleEndian);
-    int                 storage_version = 0;
-    if (storageVersion.has_value()) {
-        storage_version = *storageVersion;
-    } else if (contains("StorageVersion")) {
-        auto& version = at("StorageVersion");
-        if (version.getType() == Type::Int) { storage_version = version; }
+    std::string buffer;
+    writeTo(
+        buffer,
+        isLittleEndian ? NbtFileFormat::LittleEndianWithHeader : NbtFileFormat::BigEndianWithHeader,
+        storageVersion
+    );
+    return buffer;
+}
+
+CompoundTag CompoundTag::fromSharedBinary(std::shared_ptr<const std::string> binaryData, NbtFileFormat format) {
+    std::string_view content = *binaryData;
+    return fromSharedContent(std::move(binaryData), content, format);
+}
+
+CompoundTag
+CompoundTag::fromSharedContent(std::shared_ptr<const void> owner, std::string_view content, NbtFileFormat format) {
+    CompoundTag      result;
+    std::string_view payload = content;
+    if (format == NbtFileFormat::BedrockNetwork) {
+        SourceScope                   scope(std::move(owner), payload, format);
+        bstream::ReadOnlyBinaryStream stream(payload, false);
+        result.deserialize(stream);
+        return result;
     }
-    stream.writeInt(storage_version);
-    stream.writeLongString(toBinaryNbt(isLittleEndian));
-    return stream.getAndReleaseData();
+    auto isLittleEndian = isLittleEndianFormat(format);
+    if (hasHeader(format)) {
+        io::BytesDataInput header(payload, false, isLittleEndian);
+        header.ignoreBytes(sizeof(int));
+        payload = header.getLongStringView();
+    }
+    SourceScope        scope(std::move(owner), payload, baseFormat(isLittleEndian));
+    io::BytesDataInput stream(payload, false, isLittleEndian);
+    result.deserialize(stream);
+    return result;
 }
 
 CompoundTag CompoundTag::fromNetworkNbt(std::string_view binaryData) {
@@ -256,24 +560,28 @@ CompoundTag CompoundTag::fromNetworkNbt(std::string_view binaryData) {
 }
 
 std::string CompoundTag::toNetworkNbt() const noexcept {
-    bstream::BinaryStream stream;
-    serialize(stream);
-    return stream.getAndReleaseData();
+    std::string buffer;
+    writeTo(buffer, NbtFileFormat::BedrockNetwork);
+    return buffer;
 }
 
 CompoundTagVariant& CompoundTag::at(std::string_view index) {
     if (!contains(index)) { throw std::out_of_range(std::format("Tag not contains key: {}", index)); }
-    return mTagMap.at(std::string(index));
+    markDirty();
+    return mTagMap.at(index);
 }
 CompoundTagVariant const& CompoundTag::at(std::string_view index) const {
     if (!contains(index)) { throw std::out_of_range(std::format("Tag not contains key: {}", index)); }
-    return mTagMap.at(std::string(index));
+    return mTagMap.at(index);
 }
 
-CompoundTagVariant&       CompoundTag::operator[](std::string_view index) { return mTagMap[std::string(index)]; }
+CompoundTagVariant& CompoundTag::operator[](std::string_view index) {
+    markDirty();
+    return mTagMap[index];
+}
 CompoundTagVariant const& CompoundTag::operator[](std::string_view index) const {
     if (!contains(index)) { throw std::out_of_range(std::format("Tag not contains key: {}", index)); }
-    return mTagMap.at(std::string(index));
+    return mTagMap.at(index);
 }
 
 size_t CompoundTag::size() const noexcept {
@@ -7,6 +7,7 @@
 
 #include "nbt/types/CompoundTagVariant.hpp"
 #include "nbt/detail/SnbtDeserializer.hpp"
+#include "nbt/detail/TagCodec.hpp"
 #include "nbt/detail/SnbtSerializer.hpp"
 #include "nbt/types/CompoundTag.hpp"
 
@@ -31,13 +32,13 @@ CompoundTagVariant::CompoundTagVariant(std::string_view s) : mStorage(std::in_pl
 
 size_t CompoundTagVariant::hash() const { return get()->hash(); }
 
-void CompoundTagVariant::write(io::BytesDataOutput& stream) const { get()->write(stream); }
+void CompoundTagVariant::write(io::BytesDataOutput& stream) const { detail::writePayload(stream, *this); }
 
-void CompoundTagVariant::load(io::BytesDataInput& stream) { get()->load(stream); }
+void CompoundTagVariant::load(io::BytesDataInput& stream) { detail::loadPayload(stream, *this); }
 
-void CompoundTagVariant::write(bstream::BinaryStream& stream) const { get()->write(stream); }
+void CompoundTagVariant::write(bstream::BinaryStream& stream) const { detail::writePayload(stream, *this); }
 
-void CompoundTagVariant::load(bstream::ReadOnlyBinaryStream& stream) { get()->load(stream); }
+void CompoundTagVariant::load(bstream::ReadOnlyBinaryStream& stream) { detail::loadPayload(stream, *this); }
 
 CompoundTagVariant::iterator       CompoundTagVariant::begin() noexcept { return iterator::makeBegin(*this); }
 CompoundTagVariant::const_iterator CompoundTagVariant::begin() const noexcept { return cbegin(); }
@@ -225,6 +226,37 @@ Tag& CompoundTagVariant::emplace(Tag&& tag) {
     }
 }
 
+Tag& CompoundTagVariant::emplace(Tag::Type type) {
+    switch (type) {
+    case Tag::Type::Byte:
+        return mStorage.emplace<ByteTag>();
+    case Tag::Type::Short:
+        return mStorage.emplace<ShortTag>();
+    case Tag::Type::Int:
+        return mStorage.emplace<IntTag>();
+    case Tag::Type::Long:
+        return mStorage.emplace<LongTag>();
+    case Tag::Type::Float:
+        return mStorage.emplace<FloatTag>();
+    case Tag::Type::Double:
+        return mStorage.emplace<DoubleTag>();
+    case Tag::Type::ByteArray:
+        return mStorage.emplace<ByteArrayTag>();
+    case Tag::Type::String:
+        return mStorage.emplace<StringTag>();
+    case Tag::Type::List:
+        return mStorage.emplace<ListTag>();
+    case Tag::Type::Compound:
+        return mStorage.emplace<CompoundTag>();
+    case Tag::Type::IntArray:
+        return mStorage.emplace<IntArrayTag>();
+    case Tag::Type::LongArray:
+        return mStorage.emplace<LongArrayTag>();
+    default:
+        return mStorage.emplace<EndTag>();
+    }
+}
+
 const Tag* CompoundTagVariant::operator->() const { return get(); }
 
 Tag* CompoundTagVariant::operator->() { return get(); }
@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/types/IntArrayTag.hpp"
+#include <algorithm>
 
 namespace nbt {
 
@@ -35,13 +36,15 @@ std::size_t IntArrayTag::hash() const {
 
 void IntArrayTag::write(io::BytesDataOutput& stream) const {
     stream.writeInt((int)mStorage.size());
-    for (const int i : mStorage) { stream.writeInt(i); }
+    stream.writeArray<int>(mStorage);
 }
 
 void IntArrayTag::load(io::BytesDataInput& stream) {
-    auto size = stream.getInt();
-    mStorage.clear();
-    for (int i = 0; i < size; ++i) { mStorage.push_back(stream.getInt()); }
+    auto size      = static_cast<size_t>(std::max(stream.getInt(), 0));
+    auto available = (stream.size() - std::min(stream.getPosition(), stream.size())) / sizeof(int);
+    mStorage.resize(std::min(size, available));
+    stream.getArray(std::span(mStorage));
+    if (mStorage.size() < size) { stream.ignoreBytes((size - mStorage.size()) * sizeof(int)); }
 }
 
 void IntArrayTag::write(bstream::BinaryStream& stream) const {
@@ -6,19 +6,258 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/types/ListTag.hpp"
+#include "nbt/detail/TagCodec.hpp"
 #include "nbt/types/CompoundTagVariant.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <stdexcept>
 
 namespace nbt {
 
+namespace {
+
+template <typename T>
+struct PackedElement;
+
+template <>
+struct PackedElement<uint8_t> {
+    using type = ByteTag;
+};
+
+template <>
+struct PackedElement<int16_t> {
+    using type = ShortTag;
+};
+
+template <>
+struct PackedElement<int> {
+    using type = IntTag;
+};
+
+template <>
+struct PackedElement<int64_t> {
+    using type = LongTag;
+};
+
+template <>
+struct PackedElement<float> {
+    using type = FloatTag;
+};
+
+template <>
+struct PackedElement<double> {
+    using type = DoubleTag;
+};
+
+template <typename T>
+using PackedTag = typename PackedElement<T>::type;
+
+template <typename Fn>
+bool visitPackedType(Tag::Type type, Fn&& fn) {
+    switch (type) {
+    case Tag::Type::Byte:
+        fn.template operator()<uint8_t>();
+        return true;
+    case Tag::Type::Short:
+        fn.template operator()<int16_t>();
+        return true;
+    case Tag::Type::Int:
+        fn.template operator()<int>();
+        return true;
+    case Tag::Type::Long:
+        fn.template operator()<int64_t>();
+        return true;
+    case Tag::Type::Float:
+        fn.template operator()<float>();
+        return true;
+    case Tag::Type::Double:
+        fn.template operator()<double>();
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 struct ListTag::TagListImpl {
-    TagList mStorage;
+    using PackedList = std::variant<
+        std::monostate,
+        std::vector<uint8_t>,
+        std::vector<int16_t>,
+        std::vector<int>,
+        std::vector<int64_t>,
+        std::vector<float>,
+        std::vector<double>>;
+
+    TagList                       mStorage;
+    PackedList                    mPacked;
+    mutable std::atomic<TagList*> mView{nullptr};
 
     TagListImpl() = default;
     TagListImpl(TagList const& tags) : mStorage(tags) {}
     TagListImpl(TagList&& tags) : mStorage(std::move(tags)) {}
+    TagListImpl(TagListImpl const& other) : mStorage(other.mStorage), mPacked(other.mPacked) {}
+
+    ~TagListImpl() { resetView(); }
+
+    [[nodiscard]] bool isPacked() const noexcept { return mPacked.index() != 0; }
+
+    [[nodiscard]] Type getPackedType() const noexcept { return static_cast<Type>(mPacked.index()); }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return std::visit(
+            [&]<typename V>(V const& values) -> size_t {
+                if constexpr (std::is_same_v<V, std::monostate>) {
+                    return mStorage.size();
+                } else {
+                    return values.size();
+                }
+            },
+            mPacked
+        );
+    }
+
+    [[nodiscard]] TagList materialize() const {
+        TagList result;
+        std::visit(
+            [&]<typename V>(V const& values) {
+                if constexpr (!std::is_same_v<V, std::monostate>) {
+                    result.reserve(values.size());
+                    for (auto value : values) {
+                        result.emplace_back(std::in_place_type<PackedTag<typename V::value_type>>, value);
+                    }
+                }
+            },
+            mPacked
+        );
+        return result;
+    }
+
+    TagList const& view() const {
+        if (!isPacked()) { return mStorage; }
+        if (auto view = mView.load(std::memory_order_acquire)) { return *view; }
+        auto     built    = std::make_unique<TagList>(materialize());
+        TagList* expected = nullptr;
+        if (mView.compare_exchange_strong(expected, built.get(), std::memory_order_acq_rel)) {
+            return *built.release();
+        }
+        return *expected;
+    }
+
+    void resetView() noexcept { delete mView.exchange(nullptr, std::memory_order_acq_rel); }
+
+    TagList& tags() {
+        if (!isPacked()) { return mStorage; }
+        if (auto view = mView.exchange(nullptr, std::memory_order_acq_rel)) {
+            mStorage = std::move(*view);
+            delete view;
+        } else {
+            mStorage = materialize();
+        }
+        mPacked = std::monostate{};
+        return mStorage;
+    }
+
+    void pack(Type type) {
+        visitPackedType(type, [&]<typename V>() {
+            std::vector<V> values;
+            values.reserve(mStorage.size());
+            for (auto const& tag : mStorage) {
+                auto element = std::get_if<PackedTag<V>>(&tag.mStorage);
+                if (!element) { throw std::runtime_error("list contains elements of another type"); }
+                values.push_back(element->storage());
+            }
+            mStorage = TagList{};
+            mPacked  = std::move(values);
+            resetView();
+        });
+    }
+
+    [[nodiscard]] bool equals(TagListImpl const& other) const {
+        if (isPacked() && other.isPacked()) { return mPacked == other.mPacked; }
+        if (!isPacked() && !other.isPacked()) { return mStorage == other.mStorage; }
+        auto& packed = isPacked() ? *this : other;
+        auto& tags   = isPacked() ? other.mStorage : mStorage;
+        return std::visit(
+            [&]<typename V>(V const& values) {
+                if constexpr (std::is_same_v<V, std::monostate>) {
+                    return false;
+                } else {
+                    if (values.size() != tags.size()) { return false; }
+                    for (size_t i = 0; i < values.size(); i++) {
+                        auto element = std::get_if<PackedTag<typename V::value_type>>(&tags[i].mStorage);
+                        if (!element || element->storage() != values[i]) { return false; }
+                    }
+                    return true;
+                }
+            },
+            packed.mPacked
+        );
+    }
+
+    bool append(Tag const& tag) {
+        if (!isPacked() || tag.getType() != getPackedType()) { return false; }
+        resetView();
+        std::visit(
+            [&]<typename V>(V& values) {
+                if constexpr (!std::is_same_v<V, std::monostate>) {
+                    values.push_back(static_cast<PackedTag<typename V::value_type> const&>(tag).storage());
+                }
+            },
+            mPacked
+        );
+        return true;
+    }
 };
 
+namespace {
+
+template <typename T, typename V>
+bool writeNumbers(ListTag::TagList const& storage, io::BytesDataOutput& stream) {
+    if (!std::ranges::all_of(storage, [](auto const& tag) { return std::holds_alternative<T>(tag.mStorage); })) {
+        return false;
+    }
+    std::array<V, 1024> chunk;
+    for (size_t offset = 0; offset < storage.size(); offset += chunk.size()) {
+        auto length = std::min(chunk.size(), storage.size() - offset);
+        for (size_t i = 0; i < length; i++) { chunk[i] = std::get<T>(storage[offset + i].mStorage).storage(); }
+        stream.writeArray<V>(std::span(chunk.data(), length));
+    }
+    return true;
+}
+
+bool writeNumberList(Tag::Type type, ListTag::TagList const& storage, io::BytesDataOutput& stream) {
+    bool written = false;
+    visitPackedType(type, [&]<typename V>() { written = writeNumbers<PackedTag<V>, V>(storage, stream); });
+    return written;
+}
+
+bool loadPacked(ListTag::TagListImpl& impl, Tag::Type type, io::BytesDataInput& stream, size_t size) {
+    return visitPackedType(type, [&]<typename V>() {
+        auto& values    = impl.mPacked.emplace<std::vector<V>>();
+        auto  available = (stream.size() - std::min(stream.getPosition(), stream.size())) / sizeof(V);
+        values.resize(std::min(size, available));
+        stream.getArray(std::span(values));
+        if (values.size() < size) { stream.ignoreBytes((size - values.size()) * sizeof(V)); }
+    });
+}
+
+using NetworkCodec = detail::Codec<NbtFileFormat::BedrockNetwork>;
+
+bool loadPacked(ListTag::TagListImpl& impl, Tag::Type type, bstream::ReadOnlyBinaryStream& stream, size_t size) {
+    return visitPackedType(type, [&]<typename V>() {
+        auto& values = impl.mPacked.emplace<std::vector<V>>();
+        values.reserve(std::min(size, stream.size() - std::min(stream.getPosition(), stream.size())));
+        for (size_t i = 0; i < size && !stream.isOverflowed(); i++) {
+            values.push_back(NetworkCodec::readScalar<V>(stream));
+        }
+    });
+}
+
+} // namespace
+
 ListTag::ListTag() : mStorageImpl(std::make_unique<TagListImpl>()) {}
 
 ListTag::ListTag(std::initializer_list<CompoundTagVariant> tags) : mStorageImpl(std::make_unique<TagListImpl>(tags)) {
@@ -34,12 +273,12 @@ ListTag::ListTag(std::vector<CompoundTagVariant>&& tags)
     if (!mStorageImpl->mStorage.empty()) { mType = mStorageImpl->mStorage.front()->getType(); }
 }
 
-ListTag::ListTag(std::vector<std::unique_ptr<Tag>> const& tags) {
+ListTag::ListTag(std::vector<std::unique_ptr<Tag>> const& tags) : mStorageImpl(std::make_unique<TagListImpl>()) {
     for (auto& tag : tags) { mStorageImpl->mStorage.emplace_back(*tag); }
     if (!mStorageImpl->mStorage.empty()) { mType = mStorageImpl->mStorage.front()->getType(); }
 }
 
-ListTag::ListTag(std::vector<std::unique_ptr<Tag>>&& tags) {
+ListTag::ListTag(std::vector<std::unique_ptr<Tag>>&& tags) : mStorageImpl(std::make_unique<TagListImpl>()) {
     for (auto&& tag : tags) { mStorageImpl->mStorage.push_back(std::move(tag)); }
     if (!mStorageImpl->mStorage.empty()) { mType = mStorageImpl->mStorage.front()->getType(); }
 }
@@ -48,23 +287,23 @@ ListTag::~ListTag() = default;
 
 ListTag::ListTag(ListTag const& other) {
     mType        = other.mType;
-    mStorageImpl = std::make_unique<TagListImpl>(other.mStorageImpl->mStorage);
+    mStorageImpl = std::make_unique<TagListImpl>(*other.mStorageImpl);
 }
 
 ListTag::ListTag(ListTag&& other) = default;
 
 ListTag& ListTag::operator=(ListTag const& other) {
-    mType = other.mType;
-    mStorageImpl->mStorage.clear();
-    mStorageImpl->mStorage = other.mStorageImpl->mStorage;
+    if (this == &other) { return *this; }
+    mType        = other.mType;
+    mStorageImpl = std::make_unique<TagListImpl>(*other.mStorageImpl);
     return *this;
 }
 
 ListTag& ListTag::operator=(ListTag&& other) = default;
 
 bool ListTag::equals(Tag const& other) const {
-    return (other.getType() == Type::List)
-        && (mStorageImpl->mStorage == static_cast<const ListTag&>(other).mStorageImpl->mStorage);
+    if (other.getType() != Type::List) { return false; }
+    return mStorageImpl->equals(*static_cast<const ListTag&>(other).mStorageImpl);
 }
 
 Tag::Type ListTag::getType() const { return Type::List; }
@@ -72,116 +311,157 @@ Tag::Type ListTag::getType() const { return Type::List; }
 std::unique_ptr<Tag> ListTag::copy() const { return clone(); }
 
 std::size_t ListTag::hash() const {
-    std::size_t hash = 0;
-    for (auto& value : mStorageImpl->mStorage) {
-        std::size_t element_hash  = value.hash();
-        hash                     ^= element_hash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-    }
+    std::size_t hash    = 0;
+    auto        combine = [&](std::size_t element_hash) {
+        hash ^= element_hash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    std::visit(
+        [&]<typename V>(V const& values) {
+            if constexpr (std::is_same_v<V, std::monostate>) {
+                for (auto& value : mStorageImpl->mStorage) { combine(value.hash()); }
+            } else {
+                for (auto value : values) { combine(PackedTag<typename V::value_type>(value).hash()); }
+            }
+        },
+        mStorageImpl->mPacked
+    );
     return hash;
 }
 
-std::unique_ptr<ListTag> ListTag::clone() const { return std::make_unique<ListTag>(mStorageImpl->mStorage); }
+std::unique_ptr<ListTag> ListTag::clone() const { return std::make_unique<ListTag>(*this); }
 
 void ListTag::write(io::BytesDataOutput& stream) const {
+    if (mStorageImpl->isPacked()) {
+        stream.writeByte(static_cast<uint8_t>(mStorageImpl->getPackedType()));
+        std::visit(
+            [&]<typename V>(V const& values) {
+                if constexpr (!std::is_same_v<V, std::monostate>) {
+                    stream.writeInt(static_cast<int>(values.size()));
+                    stream.writeArray<typename V::value_type>(values);
+                }
+            },
+            mStorageImpl->mPacked
+        );
+        return;
+    }
     stream.writeByte(static_cast<uint8_t>(mType));
     stream.writeInt(static_cast<int>(mStorageImpl->mStorage.size()));
-    for (const auto& data : mStorageImpl->mStorage) { data->write(stream); }
+    if (writeNumberList(mType, mStorageImpl->mStorage, stream)) { return; }
+    detail::visitCodec(stream, [&]<typename C>(C) { C::writeElements(stream, mStorageImpl->mStorage); });
 }
 
 void ListTag::load(io::BytesDataInput& stream) {
+    clear();
     mType     = static_cast<Type>(stream.getByte());
     auto size = stream.getInt();
-    for (int i = 0; i < size; i++) {
-        if (auto tag = Tag::newTag(mType)) {
-            tag->load(stream);
-            mStorageImpl->mStorage.emplace_back(std::move(tag));
-        }
-    }
+    if (size <= 0 || mType == Type::End || mType >= Type::NumTagTypes) { return; }
+    if (loadPacked(*mStorageImpl, mType, stream, static_cast<size_t>(size))) { return; }
+    reserve(std::min(static_cast<size_t>(size), stream.size() - std::min(stream.getPosition(), stream.size())));
+    detail::visitCodec(stream, [&]<typename C>(C) {
+        C::loadElements(stream, mStorageImpl->mStorage, mType, static_cast<size_t>(size));
+    });
 }
 
 void ListTag::write(bstream::BinaryStream& stream) const {
+    if (mStorageImpl->isPacked()) {
+        stream.writeByte(static_cast<std::byte>(mStorageImpl->getPackedType()));
+        std::visit(
+            [&]<typename V>(V const& values) {
+                if constexpr (!std::is_same_v<V, std::monostate>) {
+                    stream.writeVarInt(static_cast<int>(values.size()));
+                    for (auto value : values) { NetworkCodec::writeScalar(stream, value); }
+                }
+            },
+            mStorageImpl->mPacked
+        );
+        return;
+    }
     stream.writeByte(static_cast<std::byte>(mType));
     stream.writeVarInt(static_cast<int>(mStorageImpl->mStorage.size()));
-    for (const auto& data : mStorageImpl->mStorage) { data->write(stream); }
+    detail::visitCodec(stream, [&]<typename C>(C) { C::writeElements(stream, mStorageImpl->mStorage); });
 }
 
 void ListTag::load(bstream::ReadOnlyBinaryStream& stream) {
+    clear();
     mType     = static_cast<Type>(stream.getByte());
     auto size = stream.getVarInt();
-    for (int i = 0; i < size; i++) {
-        if (auto tag = Tag::newTag(mType)) {
-            tag->load(stream);
-            mStorageImpl->mStorage.emplace_back(std::move(tag));
-        }
-    }
+    if (size <= 0 || mType == Type::End || mType >= Type::NumTagTypes) { return; }
+    if (loadPacked(*mStorageImpl, mType, stream, static_cast<size_t>(size))) { return; }
+    reserve(std::min(static_cast<size_t>(size), stream.size() - std::min(stream.getPosition(), stream.size())));
+    detail::visitCodec(stream, [&]<typename C>(C) {
+        C::loadElements(stream, mStorageImpl->mStorage, mType, static_cast<size_t>(size));
+    });
 }
 
 void ListTag::merge(ListTag const& other) {
     if (other.empty()) { return; }
+    auto& storage      = mStorageImpl->tags();
+    auto& otherStorage = other.mStorageImpl->view();
     if (mType == other.mType) {
-        for (auto const& val : other.mStorageImpl->mStorage) {
+        for (auto const& val : otherStorage) {
             bool isEqual = false;
-            for (const auto& tag : mStorageImpl->mStorage) {
+            for (const auto& tag : storage) {
                 if (tag->equals(*val)) {
                     isEqual = true;
                     break;
                 }
             }
-            if (!isEqual) { mStorageImpl->mStorage.emplace_back(val); }
+            if (!isEqual) { storage.emplace_back(val); }
         }
     } else {
         mType = other.mType;
-        mStorageImpl->mStorage.clear();
-        for (const auto& data : other.mStorageImpl->mStorage) { mStorageImpl->mStorage.emplace_back(data); }
+        storage.clear();
+        for (const auto& data : otherStorage) { storage.emplace_back(data); }
     }
 }
 
 void ListTag::push_back(std::unique_ptr<Tag>&& tag) {
-    if (mStorageImpl->mStorage.empty()) { mType = tag->getType(); }
-    mStorageImpl->mStorage.emplace_back(std::move(tag));
+    if (empty()) { mType = tag->getType(); }
+    if (!mStorageImpl->append(*tag)) { mStorageImpl->tags().emplace_back(std::move(tag)); }
 }
 
 void ListTag::push_back(Tag const& tag) {
-    if (mStorageImpl->mStorage.empty()) { mType = tag.getType(); }
-    mStorageImpl->mStorage.emplace_back(tag.copy());
+    if (empty()) { mType = tag.getType(); }
+    if (!mStorageImpl->append(tag)) { mStorageImpl->tags().emplace_back(tag.copy()); }
 }
 
 void ListTag::push_back(CompoundTagVariant val) {
-    if (mStorageImpl->mStorage.empty()) { mType = val.getType(); }
-    mStorageImpl->mStorage.push_back(std::move(val));
+    if (empty()) { mType = val.getType(); }
+    if (!mStorageImpl->append(*val)) { mStorageImpl->tags().push_back(std::move(val)); }
 }
 
 bool ListTag::add(std::unique_ptr<Tag>&& tag) {
-    if (mStorageImpl->mStorage.empty()) {
+    if (empty()) {
         mType = tag->getType();
     } else if (mType != tag->getType()) {
         return false;
     }
-    mStorageImpl->mStorage.emplace_back(std::move(tag));
+    if (!mStorageImpl->append(*tag)) { mStorageImpl->tags().emplace_back(std::move(tag)); }
     return true;
 }
 
 bool ListTag::add(Tag const& tag) {
-    if (mStorageImpl->mStorage.empty()) {
+    if (empty()) {
         mType = tag.getType();
     } else if (mType != tag.getType()) {
         return false;
     }
-    mStorageImpl->mStorage.emplace_back(tag.copy());
+    if (!mStorageImpl->append(tag)) { mStorageImpl->tags().emplace_back(tag.copy()); }
     return true;
 }
 
 bool ListTag::add(CompoundTagVariant val) {
-    if (mStorageImpl->mStorage.empty()) {
+    if (empty()) {
         mType = val.getType();
     } else if (mType != val.getType()) {
         return false;
     }
-    mStorageImpl->mStorage.push_back(std::move(val));
+    if (!mStorageImpl->append(*val)) { mStorageImpl->tags().push_back(std::move(val)); }
     return true;
 }
 
 bool ListTag::checkElements() {
+    if (mStorageImpl->isPacked()) { return mStorageImpl->getPackedType() == mType; }
     for (auto& tag : mStorageImpl->mStorage) {
         if (!tag.hold(mType)) { return false; }
     }
@@ -191,7 +471,7 @@ bool ListTag::checkElements() {
 bool ListTag::checkAndFixElements() {
     if (!checkElements()) {
         mType = Type::Compound;
-        for (auto& tag : mStorageImpl->mStorage) {
+        for (auto& tag : mStorageImpl->tags()) {
             if (!tag.hold(Type::Compound)) {
                 tag = CompoundTag({
                     {"", tag}
@@ -203,87 +483,150 @@ bool ListTag::checkAndFixElements() {
     return false;
 }
 
-void ListTag::reserve(size_t size) { mStorageImpl->mStorage.reserve(size); }
+void ListTag::reserve(size_t size) {
+    std::visit(
+        [&]<typename V>(V& values) {
+            if constexpr (std::is_same_v<V, std::monostate>) {
+                mStorageImpl->mStorage.reserve(size);
+            } else {
+                values.reserve(size);
+            }
+        },
+        mStorageImpl->mPacked
+    );
+}
 
 bool ListTag::remove(size_t index) {
-    if (index < mStorageImpl->mStorage.size()) {
-        mStorageImpl->mStorage.erase(
-            mStorageImpl->mStorage.begin() + static_cast<decltype(mStorageImpl->mStorage)::difference_type>(index)
-        );
+    auto& storage = mStorageImpl->tags();
+    if (index < storage.size()) {
+        storage.erase(storage.begin() + static_cast<TagList::difference_type>(index));
         return true;
     }
     return false;
 }
 
 bool ListTag::remove(size_t startIndex, size_t endIndex) {
-    if (startIndex < endIndex && endIndex < mStorageImpl->mStorage.size()) {
-        mStorageImpl->mStorage.erase(
-            mStorageImpl->mStorage.begin() + static_cast<decltype(mStorageImpl->mStorage)::difference_type>(startIndex),
-            mStorageImpl->mStorage.begin() + static_cast<decltype(mStorageImpl->mStorage)::difference_type>(endIndex)
+    auto& storage = mStorageImpl->tags();
+    if (startIndex < endIndex && endIndex < storage.size()) {
+        storage.erase(
+            storage.begin() + static_cast<TagList::difference_type>(startIndex),
+            storage.begin() + static_cast<TagList::difference_type>(endIndex)
         );
         return true;
     }
     return false;
 }
 
-void ListTag::clear() noexcept { mStorageImpl->mStorage.clear(); }
+void ListTag::clear() noexcept {
+    mStorageImpl->resetView();
+    mStorageImpl->mStorage.clear();
+    mStorageImpl->mPacked = std::monostate{};
+}
+
+ListTag::TagList&       ListTag::storage() { return mStorageImpl->tags(); }
+ListTag::TagList const& ListTag::storage() const { return mStorageImpl->view(); }
+
+size_t ListTag::size() const noexcept { return mStorageImpl->size(); }
+bool   ListTag::empty() const { return size() == 0; }
 
-ListTag::TagList&       ListTag::storage() noexcept { return mStorageImpl->mStorage; }
-ListTag::TagList const& ListTag::storage() const noexcept { return mStorageImpl->mStorage; }
+Tag::Type ListTag::getElementType() const {
+    return mStorageImpl->isPacked() ? mStorageImpl->getPackedType() : mType;
+}
+
+bool ListTag::isPacked() const noexcept { return mStorageImpl->isPacked(); }
 
-size_t ListTag::size() const noexcept { return mStorageImpl->mStorage.size(); }
-bool   ListTag::empty() const { return mStorageImpl->mStorage.empty(); }
+std::span<std::byte> ListTag::packedStorage(Type type) {
+    auto& impl = *mStorageImpl;
+    if (impl.getPackedType() != type) {
+        if (getElementType() != type) {
+            if (impl.size() == 0) { return {}; }
+            throw std::runtime_error("list element type mismatch");
+        }
+        impl.pack(type);
+    }
+    impl.resetView();
+    return std::visit(
+        [&]<typename V>(V& values) -> std::span<std::byte> {
+            if constexpr (std::is_same_v<V, std::monostate>) {
+                return {};
+            } else {
+                return std::as_writable_bytes(std::span(values));
+            }
+        },
+        impl.mPacked
+    );
+}
 
-Tag::Type ListTag::getElementType() const { return mType; }
+std::span<const std::byte> ListTag::packedStorage(Type type) const {
+    auto& impl = *mStorageImpl;
+    if (impl.getPackedType() != type) {
+        if (impl.size() == 0) { return {}; }
+        if (getElementType() != type) { throw std::runtime_error("list element type mismatch"); }
+        throw std::logic_error("list is not packed; call values() on a non-const list first");
+    }
+    return std::visit(
+        [&]<typename V>(V const& values) -> std::span<const std::byte> {
+            if constexpr (std::is_same_v<V, std::monostate>) {
+                return {};
+            } else {
+                return std::as_bytes(std::span(values));
+            }
+        },
+        impl.mPacked
+    );
+}
 
-CompoundTagVariant&       ListTag::operator[](size_t index) noexcept { return mStorageImpl->mStorage[index]; }
-CompoundTagVariant const& ListTag::operator[](size_t index) const noexcept { return mStorageImpl->mStorage[index]; }
+CompoundTagVariant&       ListTag::operator[](size_t index) { return mStorageImpl->tags()[index]; }
+CompoundTagVariant const& ListTag::operator[](size_t index) const { return mStorageImpl->view()[index]; }
 
-CompoundTagVariant&       ListTag::at(size_t index) { return mStorageImpl->mStorage.at(index); }
-CompoundTagVariant const& ListTag::at(size_t index) const { return mStorageImpl->mStorage.at(index); }
+CompoundTagVariant&       ListTag::at(size_t index) { return mStorageImpl->tags().at(index); }
+CompoundTagVariant const& ListTag::at(size_t index) const { return mStorageImpl->view().at(index); }
 
-ListTag::iterator ListTag::begin() noexcept { return mStorageImpl->mStorage.begin(); }
-ListTag::iterator ListTag::end() noexcept { return mStorageImpl->mStorage.end(); }
+ListTag::iterator ListTag::begin() { return mStorageImpl->tags().begin(); }
+ListTag::iterator ListTag::end() { return mStorageImpl->tags().end(); }
 
-ListTag::reverse_iterator ListTag::rbegin() noexcept { return mStorageImpl->mStorage.rbegin(); }
-ListTag::reverse_iterator ListTag::rend() noexcept { return mStorageImpl->mStorage.rend(); }
+ListTag::reverse_iterator ListTag::rbegin() { return mStorageImpl->tags().rbegin(); }
+ListTag::reverse_iterator ListTag::rend() { return mStorageImpl->tags().rend(); }
 
-ListTag::const_iterator ListTag::begin() const noexcept { return cbegin(); }
-ListTag::const_iterator ListTag::end() const noexcept { return cend(); }
+ListTag::const_iterator ListTag::begin() const { return cbegin(); }
+ListTag::const_iterator ListTag::end() const { return cend(); }
 
-ListTag::const_iterator ListTag::cbegin() const noexcept { return mStorageImpl->mStorage.cbegin(); }
-ListTag::const_iterator ListTag::cend() const noexcept { return mStorageImpl->mStorage.cend(); }
+ListTag::const_iterator ListTag::cbegin() const { return mStorageImpl->view().cbegin(); }
+ListTag::const_iterator ListTag::cend() const { return mStorageImpl->view().cend(); }
 
-ListTag::const_reverse_iterator ListTag::crbegin() const noexcept { return mStorageImpl->mStorage.crbegin(); }
-ListTag::const_reverse_iterator ListTag::crend() const noexcept { return mStorageImpl->mStorage.crend(); }
+ListTag::const_reverse_iterator ListTag::crbegin() const { return mStorageImpl->view().crbegin(); }
+ListTag::const_reverse_iterator ListTag::crend() const { return mStorageImpl->view().crend(); }
 
-ListTag::iterator ListTag::erase(const_iterator where) noexcept { return mStorageImpl->mStorage.erase(where); }
-ListTag::iterator ListTag::erase(const_iterator first, const_iterator last) noexcept {
-    return mStorageImpl->mStorage.erase(first, last);
+ListTag::iterator ListTag::erase(const_iterator where) { return mStorageImpl->tags().erase(where); }
+ListTag::iterator ListTag::erase(const_iterator first, const_iterator last) {
+    return mStorageImpl->tags().erase(first, last);
 }
 
 bool ListTag::set(size_t index, Tag const& tag) {
-    if (index < mStorageImpl->mStorage.size()) {
-        mStorageImpl->mStorage[index] = tag;
+    auto& storage = mStorageImpl->tags();
+    if (index < storage.size()) {
+        storage[index] = tag;
         return true;
     }
     return false;
 }
 
 bool ListTag::set(size_t index, std::unique_ptr<Tag>&& tag) {
-    if (index < mStorageImpl->mStorage.size()) {
-        mStorageImpl->mStorage[index] = std::move(tag);
+    auto& storage = mStorageImpl->tags();
+    if (index < storage.size()) {
+        storage[index] = std::move(tag);
         return true;
     }
     return false;
 }
 
 bool ListTag::set(size_t index, CompoundTagVariant tag) {
-    if (index < mStorageImpl->mStorage.size()) {
-        mStorageImpl->mStorage[index] = std::move(tag);
+    auto& storage = mStorageImpl->tags();
+    if (index < storage.size()) {
+        storage[index] = std::move(tag);
         return true;
     }
     return false;
 }
 
-} // namespace nbt
\ No newline at end of file
+} // namespace nbt
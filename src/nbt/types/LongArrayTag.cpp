@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include "nbt/types/LongArrayTag.hpp"
+#include <algorithm>
 
 namespace nbt {
 
@@ -35,13 +36,15 @@ std::size_t LongArrayTag::hash() const {
 
 void LongArrayTag::write(io::BytesDataOutput& stream) const {
     stream.writeInt((int)mStorage.size());
-    for (const int64_t i : mStorage) { stream.writeInt64(i); }
+    stream.writeArray<int64_t>(mStorage);
 }
 
 void LongArrayTag::load(io::BytesDataInput& stream) {
-    auto size = stream.getInt();
-    mStorage.clear();
-    for (int64_t i = 0; i < size; ++i) { mStorage.push_back(stream.getInt64()); }
+    auto size      = static_cast<size_t>(std::max(stream.getInt(), 0));
+    auto available = (stream.size() - std::min(stream.getPosition(), stream.size())) / sizeof(int64_t);
+    mStorage.resize(std::min(size, available));
+    stream.getArray(std::span(mStorage));
+    if (mStorage.size() < size) { stream.ignoreBytes((size - mStorage.size()) * sizeof(int64_t)); }
 }
 
 void LongArrayTag::write(bstream::BinaryStream& stream) const {
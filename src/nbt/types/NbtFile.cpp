@@ -8,12 +8,18 @@
 #include "nbt/types/NbtFile.hpp"
 #include "nbt/detail/FileUtils.hpp"
 #include "nbt/io/NBTIO.hpp"
+#include "nbt/io/SaveScheduler.hpp"
 #include <fstream>
 
 namespace nbt {
 
 NbtFile::~NbtFile() {
-    if (mAutoSave) { save(); }
+    if (!mAutoSave) { return; }
+    if (mSaveScheduler) {
+        enqueueSave(std::move(*this));
+    } else {
+        save();
+    }
 }
 
 NbtFile::NbtFile(
@@ -41,45 +47,86 @@ NbtFile::NbtFile(
 
 void NbtFile::setFilePath(std::filesystem::path const& filePath) { mFilePath = filePath; }
 
-void NbtFile::save() const {
+void NbtFile::setSaveMode(NbtSaveMode mode) { mSaveMode = mode; }
+
+void NbtFile::setSaveScheduler(std::shared_ptr<io::SaveScheduler> scheduler) {
+    mSaveScheduler = std::move(scheduler);
+}
+
+std::shared_future<bool> NbtFile::enqueueSave(CompoundTag&& data) const {
     if (mIsSnbtFile) {
-        io::saveSnbtToFile(*this, mFilePath, mSnbtFormat.value_or(SnbtFormat::Minimize), mSnbtIndent.value_or(4));
+        return mSaveScheduler->enqueueSnbt(
+            std::move(data),
+            mFilePath,
+            mSnbtFormat.value_or(SnbtFormat::Minimize),
+            mSnbtIndent.value_or(4),
+            SnbtNumberFormat::Default,
+            mSaveMode
+        );
     } else {
-        io::saveToFile(
-            *this,
+        return mSaveScheduler->enqueue(
+            std::move(data),
             mFilePath,
             mFileFormat.value_or(NbtFileFormat::LittleEndian),
             mCompressionType.value_or(NbtCompressionType::Gzip),
-            mCompressionLevel.value_or(NbtCompressionLevel::Default)
+            mCompressionLevel.value_or(NbtCompressionLevel::Default),
+            std::nullopt,
+            mSaveMode
         );
     }
 }
 
+std::shared_future<bool> NbtFile::save() const {
+    if (mSaveScheduler) { return enqueueSave(CompoundTag(*this)); }
+    std::promise<bool> result;
+    if (mIsSnbtFile) {
+        result.set_value(io::saveSnbtToFile(
+            *this,
+            mFilePath,
+            mSnbtFormat.value_or(SnbtFormat::Minimize),
+            mSnbtIndent.value_or(4),
+            SnbtNumberFormat::Default,
+            mSaveMode
+        ));
+    } else {
+        result.set_value(io::saveToFile(
+            *this,
+            mFilePath,
+            mFileFormat.value_or(NbtFileFormat::LittleEndian),
+            mCompressionType.value_or(NbtCompressionType::Gzip),
+            mCompressionLevel.value_or(NbtCompressionLevel::Default),
+            std::nullopt,
+            mSaveMode
+        ));
+    }
+    return result.get_future().share();
+}
+
 std::optional<NbtFile> NbtFile::open(
     std::filesystem::path const& filePath,
     std::optional<NbtFileFormat> fileFormat,
     bool                         fileMemoryMap,
     bool                         strictMatchSize
 ) {
-    std::string content;
-    auto        absPath = std::filesystem::absolute(filePath);
-    detail::readFile(absPath, content, fileMemoryMap);
-    if (!fileFormat.has_value()) { fileFormat = io::detectContentFormat(content, strictMatchSize); }
-    if (auto data = io::parseFromContent(content, fileFormat, strictMatchSize)) {
-        auto compressionType = io::detectContentCompressionType(content);
-        return NbtFile(
-            absPath,
-            std::move(data).value(),
-            false,
-            fileFormat,
-            compressionType,
-            NbtCompressionLevel::Default,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt
-        );
-    }
-    return std::nullopt;
+    auto absPath = std::filesystem::absolute(filePath);
+    return detail::visitFileContent(absPath, fileMemoryMap, [&](std::string_view content) -> std::optional<NbtFile> {
+        if (!fileFormat.has_value()) { fileFormat = io::detectContentFormat(content, strictMatchSize); }
+        if (auto data = io::parseFromContent(content, fileFormat, strictMatchSize)) {
+            auto compressionType = io::detectContentCompressionType(content);
+            return NbtFile(
+                absPath,
+                std::move(data).value(),
+                false,
+                fileFormat,
+                compressionType,
+                NbtCompressionLevel::Default,
+                std::nullopt,
+                std::nullopt,
+                std::nullopt
+            );
+        }
+        return std::nullopt;
+    });
 }
 
 std::optional<NbtFile> NbtFile::openSnbt(std::filesystem::path const& filePath) {
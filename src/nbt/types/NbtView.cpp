@@ -0,0 +1,411 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/types/NbtView.hpp"
+#include "nbt/detail/Validate.hpp"
+#include "nbt/io/NBTIO.hpp"
+#include <charconv>
+
+namespace nbt {
+
+namespace {
+
+NbtFileFormat normalizeFormat(NbtFileFormat format) noexcept {
+    switch (format) {
+    case NbtFileFormat::LittleEndianWithHeader:
+        return NbtFileFormat::LittleEndian;
+    case NbtFileFormat::BigEndianWithHeader:
+        return NbtFileFormat::BigEndian;
+    default:
+        return format;
+    }
+}
+
+template <typename Fn>
+decltype(auto) visitStream(std::string_view data, NbtFileFormat format, Fn&& fn) {
+    if (format == NbtFileFormat::BedrockNetwork) {
+        bstream::ReadOnlyBinaryStream stream(data, false);
+        return fn(stream);
+    }
+    io::BytesDataInput stream(data, false, format == NbtFileFormat::LittleEndian);
+    return fn(stream);
+}
+
+bool isGood(io::BytesDataInput& stream) noexcept { return !stream.isOverflowed(); }
+bool isGood(bstream::ReadOnlyBinaryStream& stream) noexcept {
+    return !stream.isOverflowed() && stream.getPosition() <= stream.size();
+}
+
+uint8_t readByte(io::BytesDataInput& stream) noexcept { return stream.getByte(); }
+uint8_t readByte(bstream::ReadOnlyBinaryStream& stream) noexcept { return stream.getUnsignedChar(); }
+
+int16_t readShort(io::BytesDataInput& stream) noexcept { return stream.getShort(); }
+int16_t readShort(bstream::ReadOnlyBinaryStream& stream) noexcept { return stream.getSignedShort(); }
+
+int readInt(io::BytesDataInput& stream) noexcept { return stream.getInt(); }
+int readInt(bstream::ReadOnlyBinaryStream& stream) noexcept { return stream.getVarInt(); }
+
+int64_t readLong(io::BytesDataInput& stream) noexcept { return stream.getInt64(); }
+int64_t readLong(bstream::ReadOnlyBinaryStream& stream) noexcept { return stream.getVarInt64(); }
+
+template <typename T, typename Fn>
+std::optional<T> readScalar(NbtView const& view, Tag::Type type, Fn&& read) noexcept {
+    if (!view.hold(type)) { return std::nullopt; }
+    return visitStream(view.mData, view.mFormat, [&](auto& stream) -> std::optional<T> {
+        auto value = read(stream);
+        if (!isGood(stream)) { return std::nullopt; }
+        return value;
+    });
+}
+
+template <typename T>
+std::optional<ArrayView<T>> readArray(NbtView const& view, Tag::Type type) noexcept {
+    if (!view.hold(type)) { return std::nullopt; }
+    auto payload = view.payload();
+    if (payload.empty()) { return std::nullopt; }
+    return visitStream(payload, view.mFormat, [&](auto& stream) -> std::optional<ArrayView<T>> {
+        auto size   = readInt(stream);
+        auto offset = stream.getPosition();
+        if (!isGood(stream) || size < 0) { return std::nullopt; }
+        return ArrayView<T>(
+            std::as_bytes(std::span(payload.data() + offset, payload.size() - offset)),
+            static_cast<size_t>(size),
+            view.mFormat
+        );
+    });
+}
+
+size_t fixedElementSize(Tag::Type type, NbtFileFormat format) noexcept {
+    switch (type) {
+    case Tag::Type::Byte:
+        return sizeof(uint8_t);
+    case Tag::Type::Short:
+        return sizeof(int16_t);
+    case Tag::Type::Float:
+        return sizeof(float);
+    case Tag::Type::Double:
+        return sizeof(double);
+    case Tag::Type::Int:
+        return format == NbtFileFormat::BedrockNetwork ? 0 : sizeof(int);
+    case Tag::Type::Long:
+        return format == NbtFileFormat::BedrockNetwork ? 0 : sizeof(int64_t);
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
+NbtView::NbtView(std::string_view data, Tag::Type type, NbtFileFormat format) noexcept
+: mData(data),
+  mType(type),
+  mFormat(normalizeFormat(format)) {}
+
+std::string_view NbtView::payload() const noexcept {
+    return visitStream(mData, mFormat, [&](auto& stream) -> std::string_view {
+        if (!detail::validateTag(stream, mType, stream.size())) { return {}; }
+        return mData.substr(0, stream.getPosition());
+    });
+}
+
+std::optional<uint8_t> NbtView::getByte() const noexcept {
+    return readScalar<uint8_t>(*this, Tag::Type::Byte, [](auto& stream) { return readByte(stream); });
+}
+
+std::optional<int16_t> NbtView::getShort() const noexcept {
+    return readScalar<int16_t>(*this, Tag::Type::Short, [](auto& stream) { return readShort(stream); });
+}
+
+std::optional<int> NbtView::getInt() const noexcept {
+    return readScalar<int>(*this, Tag::Type::Int, [](auto& stream) { return readInt(stream); });
+}
+
+std::optional<int64_t> NbtView::getLong() const noexcept {
+    return readScalar<int64_t>(*this, Tag::Type::Long, [](auto& stream) { return readLong(stream); });
+}
+
+std::optional<float> NbtView::getFloat() const noexcept {
+    return readScalar<float>(*this, Tag::Type::Float, [](auto& stream) { return stream.getFloat(); });
+}
+
+std::optional<double> NbtView::getDouble() const noexcept {
+    return readScalar<double>(*this, Tag::Type::Double, [](auto& stream) { return stream.getDouble(); });
+}
+
+std::optional<std::string_view> NbtView::getString() const noexcept {
+    if (!hold(Tag::Type::String)) { return std::nullopt; }
+    auto payload = this->payload();
+    if (payload.empty()) { return std::nullopt; }
+    return visitStream(payload, mFormat, [](auto& stream) -> std::string_view { return stream.getStringView(); });
+}
+
+std::optional<std::span<const uint8_t>> NbtView::getByteArray() const noexcept {
+    if (!hold(Tag::Type::ByteArray)) { return std::nullopt; }
+    auto payload = this->payload();
+    if (payload.empty()) { return std::nullopt; }
+    return visitStream(payload, mFormat, [&](auto& stream) -> std::span<const uint8_t> {
+        auto size   = static_cast<size_t>(readInt(stream));
+        auto offset = stream.getPosition();
+        return {reinterpret_cast<const uint8_t*>(payload.data() + offset), size};
+    });
+}
+
+std::optional<ArrayView<int>> NbtView::getIntArray() const noexcept {
+    return readArray<int>(*this, Tag::Type::IntArray);
+}
+
+std::optional<ArrayView<int64_t>> NbtView::getLongArray() const noexcept {
+    return readArray<int64_t>(*this, Tag::Type::LongArray);
+}
+
+std::optional<CompoundView> NbtView::asCompound() const noexcept {
+    if (!hold(Tag::Type::Compound)) { return std::nullopt; }
+    return CompoundView(mData, mFormat);
+}
+
+std::optional<ListView> NbtView::asList() const noexcept {
+    if (!hold(Tag::Type::List)) { return std::nullopt; }
+    return ListView(mData, mFormat);
+}
+
+std::optional<CompoundTagVariant> NbtView::materialize() const {
+    if (mType >= Tag::Type::NumTagTypes) { return std::nullopt; }
+    auto payload = this->payload();
+    if (payload.empty() && !is_null()) { return std::nullopt; }
+    CompoundTagVariant result;
+    auto&              tag = result.emplace(mType);
+    visitStream(payload, mFormat, [&](auto& stream) { tag.load(stream); });
+    return result;
+}
+
+std::optional<NbtView> NbtView::query(std::string_view path) const noexcept {
+    NbtView current = *this;
+    size_t  pos     = 0;
+    while (pos < path.size()) {
+        if (path[pos] == '[') {
+            auto close = path.find(']', pos);
+            if (close == std::string_view::npos) { return std::nullopt; }
+            size_t index{};
+            auto [ptr, ec] = std::from_chars(path.data() + pos + 1, path.data() + close, index);
+            if (ec != std::errc{} || ptr != path.data() + close) { return std::nullopt; }
+            auto list = current.asList();
+            if (!list) { return std::nullopt; }
+            auto element = list->at(index);
+            if (!element) { return std::nullopt; }
+            current = *element;
+            pos     = close + 1;
+            continue;
+        }
+        if (path[pos] == '.') { pos++; }
+        std::string_view key;
+        if (pos < path.size() && path[pos] == '"') {
+            auto close = path.find('"', pos + 1);
+            if (close == std::string_view::npos) { return std::nullopt; }
+            key = path.substr(pos + 1, close - pos - 1);
+            pos = close + 1;
+        } else {
+            auto end = std::min(path.find_first_of(".[", pos), path.size());
+            key      = path.substr(pos, end - pos);
+            pos      = end;
+        }
+        auto compound = current.asCompound();
+        if (!compound) { return std::nullopt; }
+        auto value = compound->find(key);
+        if (!value) { return std::nullopt; }
+        current = *value;
+    }
+    return current;
+}
+
+NbtView NbtView::operator[](std::string_view key) const noexcept {
+    if (auto compound = asCompound()) { return compound->find(key).value_or(NbtView{}); }
+    return {};
+}
+
+NbtView NbtView::operator[](size_t index) const noexcept {
+    if (auto list = asList()) { return list->at(index).value_or(NbtView{}); }
+    return {};
+}
+
+CompoundView::Iterator::Iterator(std::string_view data, size_t offset, NbtFileFormat format) noexcept
+: mData(data),
+  mOffset(offset),
+  mFormat(format) {
+    if (mOffset == std::string_view::npos || mOffset >= mData.size()) {
+        mOffset = std::string_view::npos;
+        return;
+    }
+    visitStream(mData.substr(mOffset), mFormat, [&](auto& stream) {
+        auto type = static_cast<Tag::Type>(readByte(stream));
+        if (!isGood(stream) || type == Tag::Type::End || type >= Tag::Type::NumTagTypes) {
+            mOffset = std::string_view::npos;
+            return;
+        }
+        auto key = stream.getStringView();
+        if (!isGood(stream)) {
+            mOffset = std::string_view::npos;
+            return;
+        }
+        auto valueOffset = stream.getPosition();
+        if (!detail::validateTag(stream, type, stream.size())) {
+            mOffset = std::string_view::npos;
+            return;
+        }
+        mEntry = {key, NbtView(mData.substr(mOffset + valueOffset), type, mFormat)};
+        mNext  = mOffset + stream.getPosition();
+    });
+}
+
+CompoundView::Iterator& CompoundView::Iterator::operator++() noexcept {
+    *this = Iterator(mData, mNext, mFormat);
+    return *this;
+}
+
+CompoundView::CompoundView(std::string_view data, NbtFileFormat format) noexcept
+: NbtView(data, Tag::Type::Compound, format) {}
+
+CompoundView::iterator CompoundView::begin() const noexcept { return Iterator(mData, 0, mFormat); }
+CompoundView::iterator CompoundView::end() const noexcept { return Iterator(); }
+
+std::optional<NbtView> CompoundView::find(std::string_view key) const noexcept {
+    for (auto const& [name, value] : *this) {
+        if (name == key) { return value; }
+    }
+    return std::nullopt;
+}
+
+bool CompoundView::contains(std::string_view key) const noexcept { return find(key).has_value(); }
+
+bool CompoundView::contains(std::string_view key, Tag::Type type) const noexcept {
+    if (auto value = find(key)) { return value->hold(type); }
+    return false;
+}
+
+size_t CompoundView::size() const noexcept { return static_cast<size_t>(std::distance(begin(), end())); }
+
+bool CompoundView::empty() const noexcept { return begin() == end(); }
+
+std::optional<CompoundTag> CompoundView::materialize() const {
+    if (auto result = NbtView::materialize()) { return std::move(result->as<CompoundTag>()); }
+    return std::nullopt;
+}
+
+std::optional<CompoundView> CompoundView::fromNetworkNbt(std::string_view binaryData) noexcept {
+    bstream::ReadOnlyBinaryStream stream(binaryData, false);
+    if (static_cast<Tag::Type>(stream.getByte()) != Tag::Type::Compound) { return std::nullopt; }
+    (void)stream.getStringView();
+    if (!isGood(stream)) { return std::nullopt; }
+    return CompoundView(binaryData.substr(stream.getPosition()), NbtFileFormat::BedrockNetwork);
+}
+
+std::optional<CompoundView> CompoundView::fromBinaryNbt(std::string_view binaryData, bool isLittleEndian) noexcept {
+    io::BytesDataInput stream(binaryData, false, isLittleEndian);
+    if (static_cast<Tag::Type>(stream.getByte()) != Tag::Type::Compound) { return std::nullopt; }
+    if (stream.getPosition() + sizeof(short) > stream.size()) { return std::nullopt; }
+    (void)stream.getStringView();
+    if (!isGood(stream)) { return std::nullopt; }
+    return CompoundView(
+        binaryData.substr(stream.getPosition()),
+        isLittleEndian ? NbtFileFormat::LittleEndian : NbtFileFormat::BigEndian
+    );
+}
+
+std::optional<CompoundView>
+CompoundView::fromBinaryNbtWithHeader(std::string_view binaryData, bool isLittleEndian) noexcept {
+    io::BytesDataInput stream(binaryData, false, isLittleEndian);
+    if (stream.getPosition() + (2 * sizeof(int)) > stream.size()) { return std::nullopt; }
+    stream.ignoreBytes(sizeof(int));
+    auto content = stream.getLongStringView();
+    if (!isGood(stream)) { return std::nullopt; }
+    return fromBinaryNbt(content, isLittleEndian);
+}
+
+std::optional<CompoundView> CompoundView::fromContent(
+    std::string_view             binaryData,
+    std::optional<NbtFileFormat> format,
+    bool                         strictMatchSize
+) noexcept {
+    if (!format.has_value()) { format = io::detectContentFormat(binaryData, strictMatchSize); }
+    if (!format.has_value()) { return std::nullopt; }
+    switch (*format) {
+    case NbtFileFormat::LittleEndian:
+        return fromBinaryNbt(binaryData, true);
+    case NbtFileFormat::LittleEndianWithHeader:
+        return fromBinaryNbtWithHeader(binaryData, true);
+    case NbtFileFormat::BigEndian:
+        return fromBinaryNbt(binaryData, false);
+    case NbtFileFormat::BigEndianWithHeader:
+        return fromBinaryNbtWithHeader(binaryData, false);
+    case NbtFileFormat::BedrockNetwork:
+        return fromNetworkNbt(binaryData);
+    default:
+        return std::nullopt;
+    }
+}
+
+ListView::Iterator::Iterator(
+    std::string_view data,
+    size_t           offset,
+    size_t           remaining,
+    Tag::Type        type,
+    NbtFileFormat    format
+) noexcept
+: mData(data),
+  mOffset(offset),
+  mRemaining(remaining) {
+    if (mRemaining == 0 || mOffset > mData.size()) {
+        mOffset = std::string_view::npos;
+        return;
+    }
+    mElement = NbtView(mData.substr(mOffset), type, format);
+}
+
+ListView::Iterator& ListView::Iterator::operator++() noexcept {
+    auto length = mElement.payload().size();
+    if (length == 0 && !mElement.is_null()) {
+        *this = Iterator();
+        return *this;
+    }
+    *this = Iterator(mData, mOffset + length, mRemaining - 1, mElement.mType, mElement.mFormat);
+    return *this;
+}
+
+ListView::ListView(std::string_view data, NbtFileFormat format) noexcept : NbtView(data, Tag::Type::List, format) {
+    visitStream(mData, mFormat, [&](auto& stream) {
+        auto type = static_cast<Tag::Type>(readByte(stream));
+        auto size = readInt(stream);
+        if (!isGood(stream) || size <= 0 || type >= Tag::Type::NumTagTypes) { return; }
+        mElementType    = type;
+        mSize           = static_cast<size_t>(size);
+        mElementsOffset = stream.getPosition();
+    });
+}
+
+ListView::iterator ListView::begin() const noexcept {
+    return Iterator(mData, mElementsOffset, mSize, mElementType, mFormat);
+}
+ListView::iterator ListView::end() const noexcept { return Iterator(); }
+
+std::optional<NbtView> ListView::at(size_t index) const noexcept {
+    if (index >= mSize) { return std::nullopt; }
+    if (auto width = fixedElementSize(mElementType, mFormat)) {
+        auto offset = mElementsOffset + (index * width);
+        if (offset + width > mData.size()) { return std::nullopt; }
+        return NbtView(mData.substr(offset), mElementType, mFormat);
+    }
+    auto iter = begin();
+    for (size_t i = 0; i < index && iter != end(); i++) { ++iter; }
+    if (iter == end()) { return std::nullopt; }
+    return *iter;
+}
+
+std::optional<ListTag> ListView::materialize() const {
+    if (auto result = NbtView::materialize()) { return std::move(result->as<ListTag>()); }
+    return std::nullopt;
+}
+
+} // namespace nbt
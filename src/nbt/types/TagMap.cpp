@@ -0,0 +1,324 @@
+// Copyright © 2025 GlacieTeam. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+// distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include "nbt/types/TagMap.hpp"
+#include "nbt/types/CompoundTagVariant.hpp"
+#include <algorithm>
+#include <bit>
+#include <format>
+
+namespace nbt {
+
+namespace {
+
+uint64_t makeSlot(uint64_t hash, size_t position) noexcept {
+    return (hash & ~TagMap::PositionMask) | static_cast<uint64_t>(position + 1);
+}
+
+size_t homeSlot(uint64_t hash, size_t mask) noexcept { return static_cast<size_t>(hash >> 32) & mask; }
+
+} // namespace
+
+TagMap::TagMap() = default;
+
+TagMap::TagMap(std::initializer_list<value_type> entries) { insert(entries); }
+
+TagMap::~TagMap() = default;
+
+TagMap::TagMap(TagMap const& other) {
+    mEntries.reserve(other.mSize);
+    for (auto const& entry : other) { mEntries.push_back(std::make_unique<value_type>(entry)); }
+    mSize = other.mSize;
+    rebuildIndex();
+}
+
+TagMap::TagMap(TagMap&& other) noexcept
+: mEntries(std::move(other.mEntries)),
+  mIndex(std::move(other.mIndex)),
+  mSize(std::exchange(other.mSize, 0)) {}
+
+TagMap& TagMap::operator=(TagMap const& other) {
+    if (this != &other) {
+        TagMap copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+TagMap& TagMap::operator=(TagMap&& other) noexcept {
+    if (this != &other) {
+        TagMap moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+TagMap::iterator TagMap::begin() noexcept { return iteratorAt(0); }
+TagMap::iterator TagMap::end() noexcept { return iteratorAt(mEntries.size()); }
+
+TagMap::const_iterator TagMap::begin() const noexcept {
+    return const_iterator(mEntries.data(), mEntries.data() + mEntries.size());
+}
+TagMap::const_iterator TagMap::end() const noexcept {
+    return const_iterator(mEntries.data() + mEntries.size(), mEntries.data() + mEntries.size());
+}
+
+TagMap::const_iterator TagMap::cbegin() const noexcept { return begin(); }
+TagMap::const_iterator TagMap::cend() const noexcept { return end(); }
+
+TagMap::reverse_iterator TagMap::rbegin() noexcept { return reverse_iterator(end()); }
+TagMap::reverse_iterator TagMap::rend() noexcept { return reverse_iterator(begin()); }
+
+TagMap::const_reverse_iterator TagMap::rbegin() const noexcept { return const_reverse_iterator(end()); }
+TagMap::const_reverse_iterator TagMap::rend() const noexcept { return const_reverse_iterator(begin()); }
+
+TagMap::const_reverse_iterator TagMap::crbegin() const noexcept { return rbegin(); }
+TagMap::const_reverse_iterator TagMap::crend() const noexcept { return rend(); }
+
+size_t TagMap::size() const noexcept { return mSize; }
+size_t TagMap::max_size() const noexcept { return std::min<size_t>(mEntries.max_size(), PositionMask - 1); }
+bool   TagMap::empty() const noexcept { return mSize == 0; }
+
+void TagMap::reserve(size_t size) { mEntries.reserve(size); }
+
+void TagMap::clear() noexcept {
+    mEntries.clear();
+    mIndex.reset();
+    mSize = 0;
+}
+
+void TagMap::swap(TagMap& other) noexcept {
+    mEntries.swap(other.mEntries);
+    mIndex.swap(other.mIndex);
+    std::swap(mSize, other.mSize);
+}
+
+TagMap::iterator TagMap::find(std::string_view key) noexcept {
+    auto position = findIndex(key);
+    return position == npos ? end() : iteratorAt(position);
+}
+
+TagMap::const_iterator TagMap::find(std::string_view key) const noexcept {
+    auto position = findIndex(key);
+    return position == npos ? end() : const_iterator(mEntries.data() + position, mEntries.data() + mEntries.size());
+}
+
+bool TagMap::contains(std::string_view key) const noexcept { return findIndex(key) != npos; }
+
+size_t TagMap::count(std::string_view key) const noexcept { return contains(key) ? 1 : 0; }
+
+TagMap::iterator TagMap::lower_bound(std::string_view key) noexcept { return iteratorAt(findBound(key, true)); }
+
+TagMap::const_iterator TagMap::lower_bound(std::string_view key) const noexcept {
+    return const_iterator(mEntries.data() + findBound(key, true), mEntries.data() + mEntries.size());
+}
+
+TagMap::iterator TagMap::upper_bound(std::string_view key) noexcept { return iteratorAt(findBound(key, false)); }
+
+TagMap::const_iterator TagMap::upper_bound(std::string_view key) const noexcept {
+    return const_iterator(mEntries.data() + findBound(key, false), mEntries.data() + mEntries.size());
+}
+
+CompoundTagVariant& TagMap::at(std::string_view key) {
+    auto position = findIndex(key);
+    if (position == npos) { throw std::out_of_range(std::format("Tag not contains key: {}", key)); }
+    return mEntries[position]->second;
+}
+
+CompoundTagVariant const& TagMap::at(std::string_view key) const {
+    auto position = findIndex(key);
+    if (position == npos) { throw std::out_of_range(std::format("Tag not contains key: {}", key)); }
+    return mEntries[position]->second;
+}
+
+CompoundTagVariant& TagMap::operator[](std::string_view key) { return try_emplace(key).first->second; }
+
+std::pair<TagMap::iterator, bool> TagMap::insert(value_type const& value) { return emplace(value); }
+
+std::pair<TagMap::iterator, bool> TagMap::insert(value_type&& value) { return emplace(std::move(value)); }
+
+void TagMap::insert(std::initializer_list<value_type> entries) {
+    reserve(mEntries.size() + entries.size());
+    insert(entries.begin(), entries.end());
+}
+
+TagMap::iterator TagMap::erase(const_iterator where) {
+    auto position = static_cast<size_t>(where.mNode - mEntries.data());
+    removeAt(position);
+    return iteratorAt(compact(position + 1));
+}
+
+TagMap::iterator TagMap::erase(const_iterator first, const_iterator last) {
+    auto position = static_cast<size_t>(first.mNode - mEntries.data());
+    auto stop     = static_cast<size_t>(last.mNode - mEntries.data());
+    for (; position < stop; position++) {
+        if (mEntries[position]) { removeAt(position); }
+    }
+    return iteratorAt(compact(stop));
+}
+
+size_t TagMap::erase(std::string_view key) {
+    auto position = findIndex(key);
+    if (position == npos) { return 0; }
+    removeAt(position);
+    compact(position);
+    return 1;
+}
+
+bool TagMap::rename(std::string_view key, std::string_view newKey) {
+    auto position = findIndex(key);
+    if (position == npos) { return false; }
+    if (key == newKey) { return true; }
+    if (auto target = findIndex(newKey); target != npos) {
+        mEntries[target]->second = std::move(mEntries[position]->second);
+        removeAt(position);
+        compact(position);
+    } else {
+        std::string name(newKey);
+        auto*       node = mEntries[position].get();
+        CompoundTagVariant value(std::move(node->second));
+        if (mIndex) { removeIndex(position); }
+        std::destroy_at(node);
+        try {
+            std::construct_at(
+                node,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::move(name)),
+                std::forward_as_tuple(std::move(value))
+            );
+        } catch (...) {
+            ::operator delete(mEntries[position].release());
+            mSize--;
+            compact(position);
+            throw;
+        }
+        if (mIndex) { placeIndex(position, hashKey(node->first)); }
+    }
+    return true;
+}
+
+uint64_t TagMap::hashKey(std::string_view key) noexcept {
+    return static_cast<uint64_t>(std::hash<std::string_view>{}(key)) * 0x9E3779B97F4A7C15ULL;
+}
+
+size_t TagMap::findIndex(std::string_view key) const noexcept {
+    return findIndex(key, mIndex ? hashKey(key) : 0);
+}
+
+size_t TagMap::findIndex(std::string_view key, uint64_t hash) const noexcept {
+    if (!mIndex) {
+        for (size_t i = 0; i < mEntries.size(); i++) {
+            if (mEntries[i] && mEntries[i]->first == key) { return i; }
+        }
+        return npos;
+    }
+    auto const& index = *mIndex;
+    auto        mask  = index.size() - 1;
+    for (auto slot = homeSlot(hash, mask);; slot = (slot + 1) & mask) {
+        auto entry = index[slot];
+        if (entry == 0) { return npos; }
+        if (((entry ^ hash) & ~PositionMask) != 0) { continue; }
+        auto position = static_cast<size_t>(entry & PositionMask) - 1;
+        if (mEntries[position]->first == key) { return position; }
+    }
+}
+
+size_t TagMap::findBound(std::string_view key, bool inclusive) const noexcept {
+    auto result = mEntries.size();
+    for (size_t i = 0; i < mEntries.size(); i++) {
+        if (!mEntries[i]) { continue; }
+        std::string_view current = mEntries[i]->first;
+        if (current < key || (!inclusive && current == key)) { continue; }
+        if (result == mEntries.size() || current < mEntries[result]->first) { result = i; }
+    }
+    return result;
+}
+
+TagMap::iterator TagMap::iteratorAt(size_t position) noexcept {
+    return iterator(mEntries.data() + position, mEntries.data() + mEntries.size());
+}
+
+CompoundTagVariant& TagMap::valueAt(size_t position) noexcept { return mEntries[position]->second; }
+
+TagMap::iterator TagMap::appendNode(Node&& node, uint64_t hash) {
+    mEntries.push_back(std::move(node));
+    mSize++;
+    if (mIndex || mEntries.size() >= IndexThreshold) {
+        if (!mIndex || mSize * 2 > mIndex->size()) {
+            rebuildIndex();
+        } else {
+            placeIndex(mEntries.size() - 1, hash);
+        }
+    }
+    return iteratorAt(mEntries.size() - 1);
+}
+
+std::pair<TagMap::iterator, bool> TagMap::insertNode(Node&& node) {
+    auto hash = mIndex ? hashKey(node->first) : 0;
+    if (auto position = findIndex(node->first, hash); position != npos) { return {iteratorAt(position), false}; }
+    return {appendNode(std::move(node), hash), true};
+}
+
+void TagMap::removeAt(size_t position) noexcept {
+    if (mIndex) { removeIndex(position); }
+    mEntries[position].reset();
+    mSize--;
+}
+
+size_t TagMap::compact(size_t position) {
+    while (!mEntries.empty() && !mEntries.back()) { mEntries.pop_back(); }
+    position = std::min(position, mEntries.size());
+    if (mEntries.size() - mSize <= mSize) { return position; }
+    size_t live      = 0;
+    size_t relocated = 0;
+    for (size_t i = 0; i < mEntries.size(); i++) {
+        if (i == position) { relocated = live; }
+        if (mEntries[i]) { mEntries[live++] = std::move(mEntries[i]); }
+    }
+    if (position == mEntries.size()) { relocated = live; }
+    mEntries.resize(live);
+    rebuildIndex();
+    return relocated;
+}
+
+void TagMap::rebuildIndex() {
+    if (mEntries.size() < IndexThreshold) {
+        mIndex.reset();
+        return;
+    }
+    if (!mIndex) { mIndex = std::make_unique<Index>(); }
+    mIndex->assign(std::bit_ceil(mSize * 4), 0);
+    for (size_t i = 0; i < mEntries.size(); i++) {
+        if (mEntries[i]) { placeIndex(i, hashKey(mEntries[i]->first)); }
+    }
+}
+
+void TagMap::placeIndex(size_t position, uint64_t hash) noexcept {
+    auto& index = *mIndex;
+    auto  mask  = index.size() - 1;
+    auto  slot  = homeSlot(hash, mask);
+    while (index[slot] != 0) { slot = (slot + 1) & mask; }
+    index[slot] = makeSlot(hash, position);
+}
+
+void TagMap::removeIndex(size_t position) noexcept {
+    auto& index  = *mIndex;
+    auto  mask   = index.size() - 1;
+    auto  target = static_cast<uint64_t>(position + 1);
+    auto  hole   = homeSlot(hashKey(mEntries[position]->first), mask);
+    while ((index[hole] & PositionMask) != target) { hole = (hole + 1) & mask; }
+    for (auto slot = (hole + 1) & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+        auto home = homeSlot(index[slot], mask);
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            index[hole] = index[slot];
+            hole        = slot;
+        }
+    }
+    index[hole] = 0;
+}
+
+} // namespace nbt
@@ -17,6 +17,36 @@ option("kind")
     set_showmenu(true)
 option_end()
 
+option("avx2")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Enable AVX2 byte-swap kernels")
+option_end()
+
+option("zstd")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Enable Zstandard compression support")
+option_end()
+
+option("lz4")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Enable LZ4 frame compression support")
+option_end()
+
+option("libdeflate")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Use libdeflate for one-shot Gzip/Zlib buffers")
+option_end()
+
+for _, name in ipairs({"zstd", "lz4", "libdeflate"}) do
+    if has_config(name) then
+        add_requires(name)
+    end
+end
+
 target("NBT")
     set_kind("$(kind)")
     set_languages("c++23")
@@ -38,6 +68,21 @@ target("NBT")
     if is_config("kind", "shared") then
         add_defines("_NBT_EXPORT")
     end
+    if has_config("avx2") then
+        add_vectorexts("avx2")
+    end
+    if has_config("zstd") then
+        add_packages("zstd")
+        add_defines("NBT_USE_ZSTD")
+    end
+    if has_config("lz4") then
+        add_packages("lz4")
+        add_defines("NBT_USE_LZ4")
+    end
+    if has_config("libdeflate") then
+        add_packages("libdeflate")
+        add_defines("NBT_USE_LIBDEFLATE")
+    end
     
     if is_plat("windows") then
         add_defines(
@@ -64,6 +109,9 @@ target("NBT")
             "-fexceptions",
             "-fPIC"
         )
+        if is_plat("linux") then
+            add_syslinks("pthread")
+        end
         if is_mode("release") then
             add_cxflags(
                 "-O3"